@@ -10,11 +10,17 @@
 #include <vector>
 #include <limits>  // for numeric limits
 #include <fstream>
+#include <algorithm>  // for std::max
 
 #include <CGAL/Epick_d.h>
 #include <CGAL/Epeck_d.h>
 #include <CGAL/Random.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/task_arena.h>
+#include <thread>
+#endif
+
 std::ofstream results_csv("results.csv");
 
 template <typename Kernel>
@@ -240,7 +246,72 @@ void benchmark_weighted_periodic_points(const std::string& msg) {
   }
 }
 
+#ifdef GUDHI_USE_TBB
+// Thread count scaling of the construction of the triangulation and of the complex, on the same points. With
+// complexity::FAST and CGAL built with TBB, Alpha_complex_3d inserts the points concurrently and computes its alpha
+// values in parallel, otherwise it is the sequential reference.
+template <typename Alpha_complex_3d>
+void benchmark_thread_scaling(const std::string& msg, int nb_points) {
+  using K = CGAL::Epick_d<CGAL::Dimension_tag<3>>;
+  std::cout << "+ " << msg << std::endl;
+
+  results_csv << "\"" << msg << "\";" << std::endl;
+  results_csv << "\"nb_threads\";"
+              << "\"nb_simplices\";"
+              << "\"alpha_3d_creation_time(sec.)\";"
+              << "\"complex_3d_creation_time(sec.)\";"
+              << "\"alpha_dD_creation_time(sec.)\";"
+              << "\"complex_dD_creation_time(sec.)\";" << std::endl;
+
+  std::vector<K::Point_d> points_on_torus = Gudhi::generate_points_on_torus_3D<K>(nb_points, 1.0, 0.5);
+  std::vector<typename Alpha_complex_3d::Point_3> points_3;
+  for (auto p : points_on_torus) {
+    points_3.push_back(typename Alpha_complex_3d::Point_3(p[0], p[1], p[2]));
+  }
+
+  int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int nb_threads = 1; nb_threads <= max_threads; nb_threads *= 2) {
+    std::cout << "  Alpha complex on torus with " << nb_points << " points and " << nb_threads << " threads."
+              << std::endl;
+    tbb::task_arena arena(nb_threads);
+    arena.execute([&]() {
+      Gudhi::Clock ac_3d_create_clock("    benchmark_thread_scaling - Alpha complex 3d creation");
+      Alpha_complex_3d alpha_complex_3d(points_3);
+      ac_3d_create_clock.end();
+      std::cout << ac_3d_create_clock;
+
+      Gudhi::Simplex_tree<> complex_3d;
+      Gudhi::Clock st_3d_create_clock("    benchmark_thread_scaling - complex 3d creation");
+      alpha_complex_3d.create_complex(complex_3d);
+      st_3d_create_clock.end();
+      std::cout << st_3d_create_clock;
+
+      Gudhi::Clock ac_dD_create_clock("    benchmark_thread_scaling - Alpha complex dD creation");
+      Gudhi::alpha_complex::Alpha_complex<K> alpha_complex_dD(points_on_torus);
+      ac_dD_create_clock.end();
+      std::cout << ac_dD_create_clock;
+
+      Gudhi::Simplex_tree<> complex_dD;
+      Gudhi::Clock st_dD_create_clock("    benchmark_thread_scaling - complex dD creation");
+      alpha_complex_dD.create_complex(complex_dD);
+      st_dD_create_clock.end();
+      std::cout << st_dD_create_clock;
+
+      results_csv << nb_threads << ";" << complex_3d.num_simplices() << ";" << ac_3d_create_clock.num_seconds() << ";"
+                  << st_3d_create_clock.num_seconds() << ";" << ac_dD_create_clock.num_seconds() << ";"
+                  << st_dD_create_clock.num_seconds() << ";" << std::endl;
+    });
+  }
+}
+#endif  // GUDHI_USE_TBB
+
 int main(int argc, char** argv) {
+#ifdef GUDHI_USE_TBB
+  benchmark_thread_scaling<
+      Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, false, false>>(
+      "Thread scaling - Fast version", 125000);
+#endif  // GUDHI_USE_TBB
+
   benchmark_points_on_torus_dD<CGAL::Epick_d<CGAL::Dimension_tag<3>>>("Fast static dimension version");
   benchmark_points_on_torus_dD<CGAL::Epick_d<CGAL::Dynamic_dimension_tag>>("Fast dynamic dimension version");
   benchmark_points_on_torus_dD<CGAL::Epeck_d<CGAL::Dimension_tag<3>>>("Exact static dimension version");
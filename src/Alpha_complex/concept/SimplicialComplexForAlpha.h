@@ -29,45 +29,23 @@ struct SimplicialComplexForAlpha {
   /** Returns the number of vertices in the simplicial complex. */
   std::size_t num_vertices();
 
-  /** Gets the 'simplex' dimension. */
-  int dimension(Simplex_handle simplex);
-
-  /** Assigns the 'simplex' with the given 'filtration' value. */
-  int assign_filtration(Simplex_handle simplex, Filtration_value filtration);
-
-  /** \brief Inserts a simplex with vertices from a given simplex (represented by a vector of Vertex_handle) in the
-   * simplicial complex with the given 'filtration' value. */
-  void insert_simplex_and_subfaces(std::vector<Vertex_handle> const & vertex_range, Filtration_value filtration);
-
-  /** Browses the simplicial complex to make the filtration non-decreasing. */
-  void make_filtration_non_decreasing();
-
-  /** Prune the simplicial complex above 'filtration' value given as parameter. */
-  void prune_above_filtration(Filtration_value filtration);
-
-  /** \brief Iterator over vertices of a simplex.
+  /** \brief Builds the simplicial complex from the list of all its simplices, in increasing lexicographic order.
    *
-   * 'value type' must be 'Vertex_handle'.*/
-  typedef unspecified Simplex_vertex_range;
-
-  /** \brief Returns a range over vertices of a given simplex. */
-  Simplex_vertex_range simplex_vertex_range(Simplex_handle const & simplex);
-
-  /** \brief Iterator over the boundaries of the complex, in an arbitrary order.
+   * Each element `s` of the range gives the vertices of a simplex in increasing order as `s.first`, and its
+   * filtration value as `s.second`. The filtration values are non-decreasing with respect to inclusion.
    *
-   * 'value_type' must be 'Simplex_handle'.*/
-  typedef unspecified Boundary_simplex_range;
+   * Optional: when the simplicial complex does not provide it, the simplices are inserted one by one, by increasing
+   * dimension, with `insert_simplex_and_subfaces()`. */
+  template<class SimplexFiltrationRange>
+  void insert_sorted_simplices(const SimplexFiltrationRange& simplices);
 
-  /** \brief Returns a range over boundaries of a given simplex. */
-  Boundary_simplex_range boundary_simplex_range(Simplex_handle const & simplex);
-
-  /** \brief Iterator over the simplices of the skeleton of the complex, for a given dimension.
+  /** \brief Inserts a simplex with vertices from a given simplex (represented by a vector of Vertex_handle) in the
+   * simplicial complex with the given 'filtration' value.
    *
-   * 'value_type' must be 'Simplex_handle'. */
-  typedef unspecified Skeleton_simplex_range;
-  /** \brief Returns a range over the simplices of the skeleton of the simplicial complex, for a given
-   * dimension. */
-  Skeleton_simplex_range skeleton_simplex_range;
+   * Only required when the simplicial complex does not provide `insert_sorted_simplices()`. The models of the
+   * previous versions of this concept, that also required `dimension()`, `assign_filtration()`,
+   * `make_filtration_non_decreasing()`, `prune_above_filtration()` and the simplex ranges, still work this way. */
+  void insert_simplex_and_subfaces(std::vector<Vertex_handle> const & vertex_range, Filtration_value filtration);
 
   /** \brief Return type of an insertion of a simplex
    */
@@ -38,6 +38,17 @@ struct SimplicialComplexForAlpha3d {
 
   /** Prune the simplicial complex above 'filtration' value given as parameter. */
   void prune_above_filtration(Filtration_value filtration);
+
+  /** \brief Builds the simplicial complex from the list of all its simplices, in increasing lexicographic order.
+   *
+   * Each element `s` of the range gives the vertices of a simplex in increasing order as `s.first`, and its
+   * filtration value as `s.second`. The filtration values are non-decreasing with respect to inclusion.
+   *
+   * Optional, and only used when the alpha values are computed in parallel, cf. `Alpha_complex_3d`. When the
+   * simplicial complex does not provide it, the simplices are inserted one by one, by increasing dimension, with
+   * `insert_simplex()`. */
+  template<class SimplexFiltrationRange>
+  void insert_sorted_simplices(const SimplexFiltrationRange& simplices);
 };
 
 }  // namespace alpha_complex
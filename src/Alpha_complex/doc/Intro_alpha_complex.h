@@ -128,14 +128,22 @@ namespace alpha_complex {
  *
  * As the squared radii computed by CGAL are an approximation, it might happen that these alpha squared values do not
  * quite define a proper filtration (i.e. non-decreasing with respect to inclusion).
- * We fix that up by calling `SimplicialComplexForAlpha::make_filtration_non_decreasing()`.
+ * We fix that up by raising the filtration value of each simplex to the largest value of its faces, as
+ * `Simplex_tree::make_filtration_non_decreasing()` does.
  *
  * \subsubsection pruneabove Prune above given filtration value
  *
- * The simplex tree is pruned from the given maximum alpha squared value (cf.
- * `SimplicialComplexForAlpha::prune_above_filtration()`).
+ * The simplices above the given maximum alpha squared value are not inserted (as with
+ * `Simplex_tree::prune_above_filtration()`).
  * In the following example, the value is given by the user as argument of the program.
  *
+ * \subsubsection alphaimplementation Implementation
+ *
+ * The algorithm does not run on the simplicial complex itself. The faces of each dimension are listed in flat arrays
+ * from the Delaunay full cells, each face is visited once with its cofaces in lexicographic order, and the final
+ * complex is inserted at once with `SimplicialComplexForAlpha::insert_sorted_simplices()`, or simplex by simplex with
+ * `SimplicialComplexForAlpha::insert_simplex_and_subfaces()` when the simplicial complex does not provide it.
+ *
  *
  * \section offexample Example from OFF file
  *
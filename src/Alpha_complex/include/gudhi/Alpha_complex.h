@@ -16,6 +16,7 @@
 #include <gudhi/Debug_utils.h>
 // to construct Alpha_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
+#include <gudhi/Alpha_complex/Delaunay_complex_filtration.h>
 
 #include <stdlib.h>
 #include <math.h>  // isnan, fmax
@@ -33,7 +34,8 @@
 #include <map>
 #include <utility>  // std::pair
 #include <stdexcept>
-#include <numeric>  // for std::iota
+#include <algorithm>  // for std::sort
+#include <type_traits>  // for std::is_floating_point
 
 namespace Gudhi {
 
@@ -61,6 +63,10 @@ namespace alpha_complex {
  * 
  * \remark When Alpha_complex is constructed with an infinite value of alpha, the complex is a Delaunay complex.
  * 
+ * \remark With TBB, the filtration values of the faces of each dimension are computed in parallel in
+ * `create_complex()`, if the kernel computes with doubles (e.g. CGAL::Epick_d). The Delaunay triangulation itself is
+ * built sequentially, CGAL does not provide a concurrent version in dimension d.
+ * 
  */
 template<class Kernel = CGAL::Epick_d<CGAL::Dynamic_dimension_tag>>
 class Alpha_complex {
@@ -224,8 +230,8 @@ class Alpha_complex {
    * \tparam SimplicialComplexForAlpha must meet `SimplicialComplexForAlpha` concept.
    * 
    * @param[in] complex SimplicialComplexForAlpha to be created.
-   * @param[in] max_alpha_square maximum for alpha square value. Default value is +\f$\infty\f$, and there is very
-   * little point using anything else since it does not save time.
+   * @param[in] max_alpha_square maximum for alpha square value. Default value is +\f$\infty\f$. The simplices above
+   * it are not inserted in the complex, but their filtration values are still computed.
    * 
    * @return true if creation succeeds, false otherwise.
    * 
@@ -238,10 +244,8 @@ class Alpha_complex {
             typename Filtration_value = typename SimplicialComplexForAlpha::Filtration_value>
   bool create_complex(SimplicialComplexForAlpha& complex,
                       Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity()) {
-    // From SimplicialComplexForAlpha type required to insert into a simplicial complex (with or without subfaces).
+    // From SimplicialComplexForAlpha type required to insert into a simplicial complex.
     typedef typename SimplicialComplexForAlpha::Vertex_handle Vertex_handle;
-    typedef typename SimplicialComplexForAlpha::Simplex_handle Simplex_handle;
-    typedef std::vector<Vertex_handle> Vector_vertex;
 
     if (triangulation_ == nullptr) {
       std::cerr << "Alpha_complex cannot create_complex from a NULL triangulation\n";
@@ -257,159 +261,56 @@ class Alpha_complex {
     }
 
     // --------------------------------------------------------------------------------------------
-    // Simplex_tree construction from loop on triangulation finite full cells list
-    if (triangulation_->number_of_vertices() > 0) {
-      for (auto cit = triangulation_->finite_full_cells_begin();
-           cit != triangulation_->finite_full_cells_end();
-           ++cit) {
-        Vector_vertex vertexVector;
-#ifdef DEBUG_TRACES
-        std::cout << "Simplex_tree insertion ";
-#endif  // DEBUG_TRACES
-        for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit) {
-          if (*vit != nullptr) {
-#ifdef DEBUG_TRACES
-            std::cout << " " << (*vit)->data();
-#endif  // DEBUG_TRACES
-            // Vector of vertex construction for simplex_tree structure
-            vertexVector.push_back((*vit)->data());
-          }
-        }
-#ifdef DEBUG_TRACES
-        std::cout << std::endl;
-#endif  // DEBUG_TRACES
-        // Insert each simplex and its subfaces in the simplex tree - filtration is NaN
-        complex.insert_simplex_and_subfaces(vertexVector, std::numeric_limits<double>::quiet_NaN());
+    // Flat list of the finite full cells of the triangulation, with sorted vertices
+    if (triangulation_->number_of_vertices() == 0) return true;  // ----- >>
+    std::vector<Vertex_handle> cells;
+    std::vector<Vertex_handle> cell;
+    int top_dim = -1;
+    for (auto cit = triangulation_->finite_full_cells_begin(); cit != triangulation_->finite_full_cells_end(); ++cit) {
+      cell.clear();
+      for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit) {
+        if (*vit != nullptr) cell.push_back((*vit)->data());
       }
+      std::sort(cell.begin(), cell.end());
+      if (top_dim == -1) top_dim = static_cast<int>(cell.size()) - 1;
+      GUDHI_CHECK(static_cast<int>(cell.size()) == top_dim + 1,
+                  "Alpha_complex::create_complex - full cells of different dimensions");
+      cells.insert(cells.end(), cell.begin(), cell.end());
     }
-    // --------------------------------------------------------------------------------------------
+    if (top_dim == -1) return true;  // ----- >>
 
-    // --------------------------------------------------------------------------------------------
-    // Will be re-used many times
-    Vector_of_CGAL_points pointVector;
-    // ### For i : d -> 0
-    for (int decr_dim = triangulation_->maximal_dimension(); decr_dim >= 0; decr_dim--) {
-      // ### Foreach Sigma of dim i
-      for (Simplex_handle f_simplex : complex.skeleton_simplex_range(decr_dim)) {
-        int f_simplex_dim = complex.dimension(f_simplex);
-        if (decr_dim == f_simplex_dim) {
-          pointVector.clear();
-#ifdef DEBUG_TRACES
-          std::cout << "Sigma of dim " << decr_dim << " is";
-#endif  // DEBUG_TRACES
-          for (auto vertex : complex.simplex_vertex_range(f_simplex)) {
-            pointVector.push_back(get_point(vertex));
-#ifdef DEBUG_TRACES
-            std::cout << " " << vertex;
-#endif  // DEBUG_TRACES
-          }
-#ifdef DEBUG_TRACES
-          std::cout << std::endl;
-#endif  // DEBUG_TRACES
-          // ### If filt(Sigma) is NaN : filt(Sigma) = alpha(Sigma)
-          if (std::isnan(complex.filtration(f_simplex))) {
-            Filtration_value alpha_complex_filtration = 0.0;
-            // No need to compute squared_radius on a single point - alpha is 0.0
-            if (f_simplex_dim > 0) {
-              // squared_radius function initialization
-              Squared_Radius squared_radius = kernel_.compute_squared_radius_d_object();
-              CGAL::NT_converter<typename Geom_traits::FT, Filtration_value> cv;
-
-              alpha_complex_filtration = cv(squared_radius(pointVector.begin(), pointVector.end()));
-            }
-            complex.assign_filtration(f_simplex, alpha_complex_filtration);
-#ifdef DEBUG_TRACES
-            std::cout << "filt(Sigma) is NaN : filt(Sigma) =" << complex.filtration(f_simplex) << std::endl;
-#endif  // DEBUG_TRACES
-          }
-          // No need to propagate further, unweighted points all have value 0
-          if (decr_dim > 1)
-            propagate_alpha_filtration(complex, f_simplex);
-        }
-      }
-    }
-    // --------------------------------------------------------------------------------------------
+    // Points by vertex handle, to avoid searching vertex_handle_to_iterator_ for each face
+    std::vector<const Point_d*> points(vertex_handle_to_iterator_.rbegin()->first + 1, nullptr);
+    for (auto& vertex_and_iterator : vertex_handle_to_iterator_)
+      points[vertex_and_iterator.first] = &vertex_and_iterator.second->point();
 
     // --------------------------------------------------------------------------------------------
-    // As Alpha value is an approximation, we have to make filtration non decreasing while increasing the dimension
-    complex.make_filtration_non_decreasing();
-    // Remove all simplices that have a filtration value greater than max_alpha_square
-    complex.prune_above_filtration(max_alpha_square);
+    // The faces of a dimension are computed in parallel with TBB, with a vector of points per thread, if the kernel
+    // constructions are done with doubles: the lazy exact number types are not meant to be shared between threads.
+    Squared_Radius squared_radius = kernel_.compute_squared_radius_d_object();
+    Is_Gabriel is_gabriel = kernel_.side_of_bounded_sphere_d_object();
+    CGAL::NT_converter<typename Geom_traits::FT, Filtration_value> cv;
+    auto alpha_square = [&](const Vertex_handle* vertices, int dim, Vector_of_CGAL_points& pointVector)
+        -> Filtration_value {
+      // No need to compute squared_radius on a single point - alpha is 0.0
+      if (dim == 0) return 0.;
+      // Points in decreasing order of the vertices, as a simplicial complex lists them, to get the same rounding
+      pointVector.clear();
+      for (int i = dim; i >= 0; --i) pointVector.push_back(*points[vertices[i]]);
+      return cv(squared_radius(pointVector.begin(), pointVector.end()));
+    };
+    auto is_attached = [&](const Vertex_handle* vertices, int dim, Vertex_handle vertex,
+                           Vector_of_CGAL_points& pointVector) {
+      pointVector.clear();
+      for (int i = dim; i >= 0; --i) pointVector.push_back(*points[vertices[i]]);
+      return is_gabriel(pointVector.begin(), pointVector.end(), *points[vertex]) == CGAL::ON_BOUNDED_SIDE;
+    };
+    internal::insert_delaunay_complex<Vector_of_CGAL_points>(complex, cells, top_dim, max_alpha_square,
+                                                             std::is_floating_point<typename Geom_traits::FT>::value,
+                                                             alpha_square, is_attached);
     // --------------------------------------------------------------------------------------------
     return true;
   }
-
- private:
-  template <typename SimplicialComplexForAlpha, typename Simplex_handle>
-  void propagate_alpha_filtration(SimplicialComplexForAlpha& complex, Simplex_handle f_simplex) {
-    // From SimplicialComplexForAlpha type required to assign filtration values.
-    typedef typename SimplicialComplexForAlpha::Filtration_value Filtration_value;
-#ifdef DEBUG_TRACES
-    typedef typename SimplicialComplexForAlpha::Vertex_handle Vertex_handle;
-#endif  // DEBUG_TRACES
-
-    // ### Foreach Tau face of Sigma
-    for (auto f_boundary : complex.boundary_simplex_range(f_simplex)) {
-#ifdef DEBUG_TRACES
-      std::cout << " | --------------------------------------------------\n";
-      std::cout << " | Tau ";
-      for (auto vertex : complex.simplex_vertex_range(f_boundary)) {
-        std::cout << vertex << " ";
-      }
-      std::cout << "is a face of Sigma\n";
-      std::cout << " | isnan(complex.filtration(Tau)=" << std::isnan(complex.filtration(f_boundary)) << std::endl;
-#endif  // DEBUG_TRACES
-      // ### If filt(Tau) is not NaN
-      if (!std::isnan(complex.filtration(f_boundary))) {
-        // ### filt(Tau) = fmin(filt(Tau), filt(Sigma))
-        Filtration_value alpha_complex_filtration = fmin(complex.filtration(f_boundary),
-                                                                             complex.filtration(f_simplex));
-        complex.assign_filtration(f_boundary, alpha_complex_filtration);
-#ifdef DEBUG_TRACES
-        std::cout << " | filt(Tau) = fmin(filt(Tau), filt(Sigma)) = " << complex.filtration(f_boundary) << std::endl;
-#endif  // DEBUG_TRACES
-        // ### Else
-      } else {
-        // insert the Tau points in a vector for is_gabriel function
-        Vector_of_CGAL_points pointVector;
-#ifdef DEBUG_TRACES
-        Vertex_handle vertexForGabriel = Vertex_handle();
-#endif  // DEBUG_TRACES
-        for (auto vertex : complex.simplex_vertex_range(f_boundary)) {
-          pointVector.push_back(get_point(vertex));
-        }
-        // Retrieve the Sigma point that is not part of Tau - parameter for is_gabriel function
-        Point_d point_for_gabriel;
-        for (auto vertex : complex.simplex_vertex_range(f_simplex)) {
-          point_for_gabriel = get_point(vertex);
-          if (std::find(pointVector.begin(), pointVector.end(), point_for_gabriel) == pointVector.end()) {
-#ifdef DEBUG_TRACES
-            // vertex is not found in Tau
-            vertexForGabriel = vertex;
-#endif  // DEBUG_TRACES
-            // No need to continue loop
-            break;
-          }
-        }
-        // is_gabriel function initialization
-        Is_Gabriel is_gabriel = kernel_.side_of_bounded_sphere_d_object();
-        bool is_gab = is_gabriel(pointVector.begin(), pointVector.end(), point_for_gabriel)
-          != CGAL::ON_BOUNDED_SIDE;
-#ifdef DEBUG_TRACES
-        std::cout << " | Tau is_gabriel(Sigma)=" << is_gab << " - vertexForGabriel=" << vertexForGabriel << std::endl;
-#endif  // DEBUG_TRACES
-        // ### If Tau is not Gabriel of Sigma
-        if (false == is_gab) {
-          // ### filt(Tau) = filt(Sigma)
-          Filtration_value alpha_complex_filtration = complex.filtration(f_simplex);
-          complex.assign_filtration(f_boundary, alpha_complex_filtration);
-#ifdef DEBUG_TRACES
-          std::cout << " | filt(Tau) = filt(Sigma) = " << complex.filtration(f_boundary) << std::endl;
-#endif  // DEBUG_TRACES
-        }
-      }
-    }
-  }
 };
 
 }  // namespace alpha_complex
@@ -0,0 +1,253 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef ALPHA_COMPLEX_DELAUNAY_COMPLEX_FILTRATION_H_
+#define ALPHA_COMPLEX_DELAUNAY_COMPLEX_FILTRATION_H_
+
+#include <gudhi/Debug_utils.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <math.h>  // isnan, fmin
+
+#include <vector>
+#include <limits>  // NaN
+#include <utility>  // std::pair
+#include <numeric>  // for std::iota
+#include <algorithm>  // for std::sort, std::mismatch, std::lexicographical_compare, std::equal, std::max
+
+namespace Gudhi {
+
+namespace alpha_complex {
+
+namespace internal {
+
+/* Faces of one dimension of the Delaunay complex, in lexicographic order: the vertices of the i-th face are the
+ * (dim + 1) values starting at vertices[i * (dim + 1)]. facets[i * (dim + 1) + j] is the index, in the faces of
+ * dimension dim - 1, of the facet of the i-th face without its j-th vertex. */
+template <typename Vertex_handle, typename Filtration_value>
+struct Faces_of_dimension {
+  std::vector<Vertex_handle> vertices;
+  std::vector<Filtration_value> filtrations;
+  std::vector<std::size_t> facets;
+};
+
+/* Permutation that sorts the simplices of `vertices`, stride values each, in lexicographic order. Equal simplices
+ * keep their relative order. */
+template <typename Vertex_handle>
+std::vector<std::size_t> lexicographic_order(const std::vector<Vertex_handle>& vertices, int stride) {
+  std::vector<std::size_t> order(stride == 0 ? 0 : vertices.size() / stride);
+  std::iota(order.begin(), order.end(), 0);
+  auto less = [&](std::size_t a, std::size_t b) {
+    const Vertex_handle* first_a = vertices.data() + a * stride;
+    const Vertex_handle* first_b = vertices.data() + b * stride;
+    auto diff = std::mismatch(first_a, first_a + stride, first_b);
+    if (diff.first != first_a + stride) return *diff.first < *diff.second;
+    return a < b;
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_sort(order.begin(), order.end(), less);
+#else
+  std::sort(order.begin(), order.end(), less);
+#endif
+  return order;
+}
+
+/* Calls f(i, scratch) for each i in [0, n), where scratch is a Scratch object that f may use as a buffer. The calls
+ * run in parallel, with a Scratch object per task, when parallel is true and GUDHI is built with TBB. */
+template <typename Scratch, typename Function>
+void for_each_index(std::size_t n, bool parallel, const Function& f) {
+#ifdef GUDHI_USE_TBB
+  if (parallel) {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n), [&](const tbb::blocked_range<std::size_t>& range) {
+      Scratch scratch;
+      for (std::size_t i = range.begin(); i != range.end(); ++i) f(i, scratch);
+    });
+    return;
+  }
+#else
+  (void)parallel;
+#endif
+  Scratch scratch;
+  for (std::size_t i = 0; i < n; ++i) f(i, scratch);
+}
+
+/* Builds complex at once from simplices, in lexicographic order, when it has insert_sorted_simplices(). */
+template <typename SimplicialComplex, typename SimplexFiltrationRange>
+auto insert_simplices(SimplicialComplex& complex, const SimplexFiltrationRange& simplices, int)
+    -> decltype(complex.insert_sorted_simplices(simplices), void()) {
+  complex.insert_sorted_simplices(simplices);
+}
+
+/* Inserts a simplex, whose faces are already inserted, with insert_simplex_and_subfaces() for the models of
+ * SimplicialComplexForAlpha... */
+template <typename SimplicialComplex, typename Filtration_value>
+auto insert_simplex(SimplicialComplex& complex, const std::vector<typename SimplicialComplex::Vertex_handle>& vertices,
+                    Filtration_value filtration, int)
+    -> decltype(complex.insert_simplex_and_subfaces(vertices, filtration), void()) {
+  complex.insert_simplex_and_subfaces(vertices, filtration);
+}
+
+/* ... and with insert_simplex() for the models of SimplicialComplexForAlpha3d. */
+template <typename SimplicialComplex, typename Filtration_value>
+void insert_simplex(SimplicialComplex& complex, const std::vector<typename SimplicialComplex::Vertex_handle>& vertices,
+                    Filtration_value filtration, long) {
+  complex.insert_simplex(vertices, filtration);
+}
+
+/* Otherwise, as for the models of the previous versions of SimplicialComplexForAlpha, inserts the simplices one by one,
+ * by increasing dimension so that the faces of a simplex are already inserted with their own filtration value. */
+template <typename SimplicialComplex, typename SimplexFiltrationRange>
+void insert_simplices(SimplicialComplex& complex, const SimplexFiltrationRange& simplices, long) {
+  using Complex_vertex_handle = typename SimplicialComplex::Vertex_handle;
+  std::size_t max_size = 0;
+  for (const auto& simplex : simplices) max_size = (std::max)(max_size, simplex.first.size());
+  std::vector<Complex_vertex_handle> vertices;
+  for (std::size_t size = 1; size <= max_size; ++size) {
+    for (const auto& simplex : simplices) {
+      if (simplex.first.size() != size) continue;
+      vertices.assign(simplex.first.begin(), simplex.first.end());
+      insert_simplex(complex, vertices, simplex.second, 0);
+    }
+  }
+}
+
+/* Inserts in complex the Delaunay complex of unweighted points, with the filtration values of the alpha complex
+ * (cf. \ref createcomplexalgorithm), except the simplices with a filtration value greater than max_alpha_square.
+ *
+ * cells contains the vertices of the finite full cells of the triangulation, (top_dim + 1) per cell, sorted in each
+ * cell. alpha_square(vertices, dim, scratch) is the squared radius of the smallest circumsphere of the dim-simplex
+ * `vertices`, and is_attached(vertices, dim, vertex, scratch) tells whether the point of `vertex` lies strictly
+ * inside this sphere. The filtration values are computed once per face, from the highest dimension to the lowest.
+ * The faces of a dimension are independent, so the calls to alpha_square and is_attached for a dimension run in
+ * parallel when parallel is true, and must be thread safe then. */
+template <typename Scratch, typename SimplicialComplex, typename Vertex_handle, typename Filtration_value,
+          typename Alpha_square, typename Is_attached>
+void insert_delaunay_complex(SimplicialComplex& complex, const std::vector<Vertex_handle>& cells, int top_dim,
+                             Filtration_value max_alpha_square, bool parallel, const Alpha_square& alpha_square,
+                             const Is_attached& is_attached) {
+  std::vector<Faces_of_dimension<Vertex_handle, Filtration_value>> faces(top_dim + 1);
+  {
+    // Full cells are not faces of anything, they are sorted in lexicographic order as the others
+    auto& sorted_cells = faces[top_dim];
+    std::vector<std::size_t> order = lexicographic_order(cells, top_dim + 1);
+    sorted_cells.vertices.reserve(cells.size());
+    for (std::size_t i : order) {
+      auto first = cells.begin() + i * (top_dim + 1);
+      sorted_cells.vertices.insert(sorted_cells.vertices.end(), first, first + top_dim + 1);
+    }
+    sorted_cells.filtrations.resize(order.size());
+    for_each_index<Scratch>(order.size(), parallel, [&](std::size_t i, Scratch& scratch) {
+      sorted_cells.filtrations[i] = alpha_square(sorted_cells.vertices.data() + i * (top_dim + 1), top_dim, scratch);
+    });
+  }
+
+  for (int dim = top_dim; dim > 0; --dim) {
+    auto& cofaces = faces[dim];
+    auto& facets = faces[dim - 1];
+    const std::size_t num_cofaces = cofaces.filtrations.size();
+    // All the facets of all the cofaces, facet j of coface i being the (i * (dim + 1) + j)-th one
+    std::vector<Vertex_handle> facet_vertices;
+    facet_vertices.reserve(num_cofaces * (dim + 1) * dim);
+    for (std::size_t i = 0; i < num_cofaces; ++i) {
+      auto coface = cofaces.vertices.begin() + i * (dim + 1);
+      for (int j = 0; j <= dim; ++j) {
+        facet_vertices.insert(facet_vertices.end(), coface, coface + j);
+        facet_vertices.insert(facet_vertices.end(), coface + j + 1, coface + dim + 1);
+      }
+    }
+    // Equal facets are sorted by coface, so the cofaces of a facet are seen in lexicographic order, as in the
+    // algorithm on the simplicial complex
+    std::vector<std::size_t> order = lexicographic_order(facet_vertices, dim);
+    // Start, in order, of the cofaces of each facet
+    std::vector<std::size_t> group_starts;
+    for (std::size_t k = 0; k < order.size(); ++k) {
+      const Vertex_handle* facet = facet_vertices.data() + order[k] * dim;
+      if (k == 0 || !std::equal(facet, facet + dim, facet_vertices.data() + order[k - 1] * dim)) {
+        group_starts.push_back(k);
+        facets.vertices.insert(facets.vertices.end(), facet, facet + dim);
+      }
+    }
+    group_starts.push_back(order.size());
+    cofaces.facets.resize(order.size());
+    facets.filtrations.resize(group_starts.size() - 1);
+    for_each_index<Scratch>(facets.filtrations.size(), parallel, [&](std::size_t facet_index, Scratch& scratch) {
+      const Vertex_handle* facet = facets.vertices.data() + facet_index * dim;
+      // NaN stands for unknown value
+      Filtration_value filtration = std::numeric_limits<Filtration_value>::quiet_NaN();
+      for (std::size_t k = group_starts[facet_index]; k < group_starts[facet_index + 1]; ++k) {
+        std::size_t coface_index = order[k] / (dim + 1);
+        cofaces.facets[order[k]] = facet_index;
+        // No need to propagate to the vertices, unweighted points all have value 0
+        if (dim == 1) continue;
+        Filtration_value coface_filtration = cofaces.filtrations[coface_index];
+        if (!std::isnan(filtration)) {
+          filtration = fmin(filtration, coface_filtration);
+        } else {
+          // The point of the coface that is not part of the facet
+          const Vertex_handle* coface = cofaces.vertices.data() + coface_index * (dim + 1);
+          // If the facet is not Gabriel for the coface, it gets the filtration value of the coface
+          if (is_attached(facet, dim - 1, coface[order[k] % (dim + 1)], scratch))
+            filtration = coface_filtration;
+        }
+      }
+      if (std::isnan(filtration)) filtration = alpha_square(facet, dim - 1, scratch);
+      facets.filtrations[facet_index] = filtration;
+    });
+  }
+
+  // As Alpha value is an approximation, we have to make filtration non decreasing while increasing the dimension
+  for (int dim = 1; dim <= top_dim; ++dim) {
+    auto& simplices = faces[dim];
+    for_each_index<Scratch>(simplices.filtrations.size(), parallel, [&](std::size_t i, Scratch&) {
+      for (int j = 0; j <= dim; ++j) {
+        Filtration_value facet_filtration = faces[dim - 1].filtrations[simplices.facets[i * (dim + 1) + j]];
+        if (simplices.filtrations[i] < facet_filtration) simplices.filtrations[i] = facet_filtration;
+      }
+    });
+  }
+
+  // Merge the dimensions in lexicographic order, without the simplices that have a filtration value greater than
+  // max_alpha_square, and build the simplicial complex
+  typedef boost::iterator_range<const Vertex_handle*> Vertex_range;
+  std::vector<std::pair<Vertex_range, Filtration_value>> sorted_simplices;
+  std::vector<std::size_t> next(top_dim + 1, 0);
+  while (true) {
+    int min_dim = -1;
+    const Vertex_handle* min_simplex = nullptr;
+    for (int dim = 0; dim <= top_dim; ++dim) {
+      if (next[dim] == faces[dim].filtrations.size()) continue;
+      const Vertex_handle* simplex = faces[dim].vertices.data() + next[dim] * (dim + 1);
+      // A prefix of a simplex comes before it, hence the strict comparison with lower dimensions first
+      if (min_dim == -1 || std::lexicographical_compare(simplex, simplex + dim + 1, min_simplex,
+                                                        min_simplex + min_dim + 1)) {
+        min_dim = dim;
+        min_simplex = simplex;
+      }
+    }
+    if (min_dim == -1) break;
+    std::size_t i = next[min_dim]++;
+    Filtration_value filtration = faces[min_dim].filtrations[i];
+    if (filtration <= max_alpha_square)
+      sorted_simplices.emplace_back(Vertex_range(min_simplex, min_simplex + min_dim + 1), filtration);
+  }
+  insert_simplices(complex, sorted_simplices, 0);
+}
+
+}  // namespace internal
+
+}  // namespace alpha_complex
+
+}  // namespace Gudhi
+
+#endif  // ALPHA_COMPLEX_DELAUNAY_COMPLEX_FILTRATION_H_
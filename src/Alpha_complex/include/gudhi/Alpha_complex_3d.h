@@ -18,6 +18,7 @@
 
 #include <gudhi/Debug_utils.h>
 #include <gudhi/Alpha_complex_options.h>
+#include <gudhi/Alpha_complex/Delaunay_complex_filtration.h>
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
@@ -30,17 +31,22 @@
 #include <CGAL/Alpha_shape_3.h>
 #include <CGAL/Alpha_shape_cell_base_3.h>
 #include <CGAL/Alpha_shape_vertex_base_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
 
 #include <CGAL/Object.h>
 #include <CGAL/tuple.h>
 #include <CGAL/iterator.h>
 #include <CGAL/version.h>
+#include <CGAL/Bbox_3.h>
 
 #include <boost/container/static_vector.hpp>
 
 #include <iostream>
 #include <vector>
 #include <unordered_map>
+#include <algorithm>  // for std::sort, std::lower_bound
+#include <numeric>  // for std::iota
+#include <utility>  // for std::pair
 #include <stdexcept>
 #include <cstddef>
 #include <memory>       // for std::unique_ptr
@@ -117,6 +123,13 @@ struct Value_from_iterator<complexity::EXACT> {
  * \remark When Alpha_complex_3d is constructed with an infinite value of alpha (default value), the complex is a
  * 3d Delaunay complex.
  *
+ * \remark When GUDHI and CGAL are both built with TBB, the points of the unweighted non-periodic version with
+ * `complexity::FAST` are inserted concurrently in a CGAL Delaunay triangulation, and `create_complex()` computes the
+ * alpha values of the faces of each dimension in parallel from it, instead of the sequential CGAL Alpha_shape_3. Its
+ * vertices are then numbered in the order of the first occurrence of their point in the input range. The other
+ * versions are built sequentially: the lazy exact number types of `complexity::SAFE` and `complexity::EXACT` are not
+ * meant to be shared between threads, and the periodic triangulations cannot be built concurrently.
+ *
  */
 template <complexity Complexity = complexity::SAFE, bool Weighted = false, bool Periodic = false>
 class Alpha_complex_3d {
@@ -174,6 +187,20 @@ class Alpha_complex_3d {
   using Cb = CGAL::Alpha_shape_cell_base_3<Kernel, Tcb>;
   using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb>;
 
+#if defined(GUDHI_USE_TBB) && defined(CGAL_LINKED_WITH_TBB)
+  // Only the unweighted non-periodic triangulation with Epick is built concurrently, and its alpha values are then
+  // computed in parallel
+  static const bool Parallel_alpha_values = (Complexity == complexity::FAST) && !Weighted && !Periodic;
+
+  // Plain Delaunay triangulation with concurrent insertion, the vertex info is the vertex number in the complex
+  using Concurrent_tds =
+      CGAL::Triangulation_data_structure_3<CGAL::Triangulation_vertex_base_with_info_3<std::size_t, Kernel>,
+                                           CGAL::Triangulation_cell_base_3<Kernel>, CGAL::Parallel_tag>;
+  using Concurrent_dt = CGAL::Delaunay_triangulation_3<Kernel, Concurrent_tds>;
+#else
+  static const bool Parallel_alpha_values = false;
+#endif
+
   // The other way to do a conditional type. Here there 4 possibilities, cannot use std::conditional
   template <typename Kernel, typename Tds, bool Weighted_version, bool Periodic_version>
   struct Triangulation_3 {};
@@ -244,6 +271,10 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
  * */
   using Weighted_point_3 = typename Triangulation_3<Kernel, Tds, Weighted, Periodic>::Weighted_point_3;
 
+  /** \brief Type of the points of the vertices, `Alpha_complex_3d::Point_3` or `Alpha_complex_3d::Weighted_point_3`
+   * for the weighted versions. */
+  using Vertex_point_3 = typename Dt::Vertex::Point;
+
  private:
   using Dispatch =
       CGAL::Dispatch_output_iterator<CGAL::cpp11::tuple<CGAL::Object, FT>,
@@ -271,8 +302,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
   Alpha_complex_3d(const InputPointRange& points) {
     static_assert(!Periodic, "This constructor is not available for periodic versions of Alpha_complex_3d");
 
-    alpha_shape_3_ptr_ = std::unique_ptr<Alpha_shape_3>(
-        new Alpha_shape_3(std::begin(points), std::end(points), 0, Alpha_shape_3::GENERAL));
+    init_from_range(std::begin(points), std::end(points), std::integral_constant<bool, Parallel_alpha_values>());
   }
 
   /** \brief Alpha_complex constructor from a list of points and associated weights.
@@ -446,6 +476,9 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
       std::cerr << "Alpha_complex_3d create_complex - complex is not empty\n";
       return false;  // ----- >>
     }
+    if (alpha_shape_3_ptr_ == nullptr)
+      return create_complex_in_parallel(complex, max_alpha_square,
+                                        std::integral_constant<bool, Parallel_alpha_values>());
 
     // using Filtration_value = typename SimplicialComplexForAlpha3d::Filtration_value;
     using Complex_vertex_handle = typename SimplicialComplexForAlpha3d::Vertex_handle;
@@ -470,6 +503,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
 #endif  // DEBUG_TRACES
 
     Alpha_shape_simplex_tree_map map_cgal_simplex_tree;
+    vertex_points_.clear();
     using Alpha_value_iterator = typename std::vector<FT>::const_iterator;
     Alpha_value_iterator alpha_value_iterator = alpha_values.begin();
     for (auto object_iterator : objects) {
@@ -527,6 +561,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
 #endif  // DEBUG_TRACES
           the_simplex.push_back(vertex);
           map_cgal_simplex_tree.emplace(the_alpha_shape_vertex, vertex);
+          vertex_points_.push_back(the_alpha_shape_vertex->point());
         } else {
           // alpha shape found
           Complex_vertex_handle vertex = the_map_iterator->second;
@@ -562,9 +597,137 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
     return true;
   }
 
+  /** \brief Returns the point corresponding to the vertex given as parameter.
+   *
+   * @param[in] vertex Vertex handle of the point to retrieve.
+   * @return The point found.
+   * @exception std::out_of_range In case vertex is not found (cf. std::vector::at).
+   *
+   * @pre `create_complex()` was called before.
+   */
+  const Vertex_point_3& get_point(std::size_t vertex) const { return vertex_points_.at(vertex); }
+
  private:
-  // use of a unique_ptr on cgal Alpha_shape_3, as copy and default constructor is not available - no need to be freed
+  template <typename InputIterator>
+  void init_from_range(InputIterator first, InputIterator last, std::false_type) {
+    alpha_shape_3_ptr_ = std::unique_ptr<Alpha_shape_3>(new Alpha_shape_3(first, last, 0, Alpha_shape_3::GENERAL));
+  }
+
+  template <typename SimplicialComplexForAlpha3d, typename Filtration_value>
+  bool create_complex_in_parallel(SimplicialComplexForAlpha3d&, Filtration_value, std::false_type) {
+    return false;
+  }
+
+#if defined(GUDHI_USE_TBB) && defined(CGAL_LINKED_WITH_TBB)
+  // Inserts the points concurrently in a Delaunay triangulation, and keeps only its vertices and its finite cells.
+  // Degenerate point sets are left to CGAL Alpha_shape_3.
+  template <typename InputIterator>
+  void init_from_range(InputIterator first, InputIterator last, std::true_type) {
+    std::vector<Point_3> points(first, last);
+    // The lock grid outlives the triangulation that points to it
+    std::unique_ptr<typename Concurrent_dt::Lock_data_structure> locking_ds;
+    std::unique_ptr<Concurrent_dt> dt;
+    if (!points.empty()) {
+      CGAL::Bbox_3 bbox = points[0].bbox();
+      for (const Point_3& point : points) bbox = bbox + point.bbox();
+      // The lock grid needs a bounding box with a non-empty interior
+      if (bbox.xmin() < bbox.xmax() && bbox.ymin() < bbox.ymax() && bbox.zmin() < bbox.zmax()) {
+        // Grid of 50x50x50 locks on the bounding box
+        locking_ds = std::unique_ptr<typename Concurrent_dt::Lock_data_structure>(
+            new typename Concurrent_dt::Lock_data_structure(bbox, 50));
+        dt = std::unique_ptr<Concurrent_dt>(new Concurrent_dt(points.begin(), points.end(), locking_ds.get()));
+      }
+    }
+    if (dt == nullptr || dt->dimension() < 3) {
+      init_from_range(points.begin(), points.end(), std::false_type());
+      return;
+    }
+
+    // The order of the vertices in the concurrent triangulation depends on the threads. They are numbered in the
+    // order of the first input point they come from, the duplicate points being inserted once.
+    std::vector<std::size_t> sorted_indices(points.size());
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    std::sort(sorted_indices.begin(), sorted_indices.end(), [&](std::size_t a, std::size_t b) {
+      return points[a] < points[b] || (points[a] == points[b] && a < b);
+    });
+    std::vector<std::pair<std::size_t, typename Concurrent_dt::Vertex_handle>> vertices;
+    vertices.reserve(dt->number_of_vertices());
+    for (auto vit = dt->finite_vertices_begin(); vit != dt->finite_vertices_end(); ++vit) {
+      auto first_index = std::lower_bound(sorted_indices.begin(), sorted_indices.end(), vit->point(),
+                                          [&](std::size_t index, const Point_3& point) {
+                                            return points[index] < point;
+                                          });
+      vertices.emplace_back(*first_index, vit);
+    }
+    std::sort(vertices.begin(), vertices.end(),
+              [](const std::pair<std::size_t, typename Concurrent_dt::Vertex_handle>& a,
+                 const std::pair<std::size_t, typename Concurrent_dt::Vertex_handle>& b) {
+                return a.first < b.first;
+              });
+    vertex_points_.reserve(vertices.size());
+    for (auto& vertex : vertices) {
+      vertex.second->info() = vertex_points_.size();
+      vertex_points_.push_back(vertex.second->point());
+    }
+
+    cells_.reserve(4 * dt->number_of_finite_cells());
+    for (auto cit = dt->finite_cells_begin(); cit != dt->finite_cells_end(); ++cit) {
+      std::size_t cell[4];
+      for (int i = 0; i < 4; i++) cell[i] = cit->vertex(i)->info();
+      std::sort(cell, cell + 4);
+      cells_.insert(cells_.end(), cell, cell + 4);
+    }
+  }
+
+  // Scratch space of the filtration computation, none is needed in dimension 3
+  struct No_scratch {};
+
+  // Same filtration values as Alpha_complex, computed in parallel from the cells of the triangulation with the
+  // constructions and predicates of Epick
+  template <typename SimplicialComplexForAlpha3d, typename Filtration_value>
+  bool create_complex_in_parallel(SimplicialComplexForAlpha3d& complex, Filtration_value max_alpha_square,
+                                  std::true_type) {
+    using Complex_vertex_handle = typename SimplicialComplexForAlpha3d::Vertex_handle;
+    std::vector<Complex_vertex_handle> cells(cells_.begin(), cells_.end());
+    const std::vector<Point_3>& points = vertex_points_;
+
+    Kernel kernel;
+    typename Kernel::Compute_squared_radius_3 squared_radius = kernel.compute_squared_radius_3_object();
+    typename Kernel::Side_of_bounded_sphere_3 side_of_bounded_sphere = kernel.side_of_bounded_sphere_3_object();
+    // Points in decreasing order of the vertices, as in Alpha_complex
+    auto alpha_square = [&](const Complex_vertex_handle* vertices, int dim, No_scratch&) -> Filtration_value {
+      switch (dim) {
+        case 1:
+          return squared_radius(points[vertices[1]], points[vertices[0]]);
+        case 2:
+          return squared_radius(points[vertices[2]], points[vertices[1]], points[vertices[0]]);
+        case 3:
+          return squared_radius(points[vertices[3]], points[vertices[2]], points[vertices[1]], points[vertices[0]]);
+        default:
+          return 0.;
+      }
+    };
+    auto is_attached = [&](const Complex_vertex_handle* vertices, int dim, Complex_vertex_handle vertex,
+                           No_scratch&) {
+      if (dim == 1)
+        return side_of_bounded_sphere(points[vertices[1]], points[vertices[0]], points[vertex]) ==
+               CGAL::ON_BOUNDED_SIDE;
+      return side_of_bounded_sphere(points[vertices[2]], points[vertices[1]], points[vertices[0]], points[vertex]) ==
+             CGAL::ON_BOUNDED_SIDE;
+    };
+    internal::insert_delaunay_complex<No_scratch>(complex, cells, 3, max_alpha_square, true, alpha_square,
+                                                  is_attached);
+    return true;
+  }
+#endif
+
+  // use of a unique_ptr on cgal Alpha_shape_3, as copy and default constructor is not available - no need to be freed.
+  // It is not built when the alpha values are computed in parallel.
   std::unique_ptr<Alpha_shape_3> alpha_shape_3_ptr_;
+  // Points of the vertices of the complex, in the order of their number
+  std::vector<Vertex_point_3> vertex_points_;
+  // Vertices of the finite cells of the triangulation, 4 by 4, when the alpha values are computed in parallel
+  std::vector<std::size_t> cells_;
 };
 
 }  // namespace alpha_complex
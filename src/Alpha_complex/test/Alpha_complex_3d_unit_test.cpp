@@ -51,6 +51,29 @@ std::vector<Point> get_points() {
   return points;
 }
 
+// Vertex of other_alpha_complex that has the same point as each vertex of alpha_complex. The vertices may be numbered
+// differently, as when the alpha values of the fast version are computed in parallel.
+template <typename Alpha_complex_3d, typename Other_alpha_complex_3d>
+std::vector<int> same_point_vertices(const Alpha_complex_3d& alpha_complex, std::size_t num_vertices,
+                                     const Other_alpha_complex_3d& other_alpha_complex) {
+  std::vector<int> other_vertices;
+  for (std::size_t vertex = 0; vertex < num_vertices; vertex++) {
+    auto point = alpha_complex.get_point(vertex);
+    std::size_t other_vertex = 0;
+    while (other_vertex < num_vertices) {
+      auto other_point = other_alpha_complex.get_point(other_vertex);
+      if (CGAL::to_double(other_point.x()) == CGAL::to_double(point.x()) &&
+          CGAL::to_double(other_point.y()) == CGAL::to_double(point.y()) &&
+          CGAL::to_double(other_point.z()) == CGAL::to_double(point.z()))
+        break;
+      other_vertex++;
+    }
+    BOOST_CHECK(other_vertex < num_vertices);
+    other_vertices.push_back(other_vertex);
+  }
+  return other_vertices;
+}
+
 
 BOOST_AUTO_TEST_CASE(Alpha_complex_3d_from_points) {
   // -----------------
@@ -86,13 +109,14 @@ BOOST_AUTO_TEST_CASE(Alpha_complex_3d_from_points) {
             << stree.num_vertices() << std::endl;
   BOOST_CHECK(exact_stree.num_vertices() == stree.num_vertices());
 
+  std::vector<int> exact_vertices = same_point_vertices(alpha_complex, stree.num_vertices(), exact_alpha_complex);
   auto sh = stree.filtration_simplex_range().begin();
   while (sh != stree.filtration_simplex_range().end()) {
     std::vector<int> simplex;
     std::vector<int> exact_simplex;
     std::cout << "Fast ( ";
     for (auto vertex : stree.simplex_vertex_range(*sh)) {
-      simplex.push_back(vertex);
+      simplex.push_back(exact_vertices[vertex]);
       std::cout << vertex << " ";
     }
     std::cout << ") -> [" << stree.filtration(*sh) << "] ";
@@ -130,13 +154,14 @@ BOOST_AUTO_TEST_CASE(Alpha_complex_3d_from_points) {
             << stree.num_vertices() << std::endl;
   BOOST_CHECK(safe_stree.num_vertices() == stree.num_vertices());
 
+  std::vector<int> safe_vertices = same_point_vertices(alpha_complex, stree.num_vertices(), safe_alpha_complex);
   auto safe_sh = stree.filtration_simplex_range().begin();
   while (safe_sh != stree.filtration_simplex_range().end()) {
     std::vector<int> simplex;
     std::vector<int> exact_simplex;
     std::cout << "Fast ( ";
     for (auto vertex : stree.simplex_vertex_range(*safe_sh)) {
-      simplex.push_back(vertex);
+      simplex.push_back(safe_vertices[vertex]);
       std::cout << vertex << " ";
     }
     std::cout << ") -> [" << stree.filtration(*safe_sh) << "] ";
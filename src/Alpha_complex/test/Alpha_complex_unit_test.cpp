@@ -17,11 +17,15 @@
 
 #include <CGAL/Delaunay_triangulation.h>
 #include <CGAL/Epick_d.h>
+#include <CGAL/Epeck_d.h>
+#include <CGAL/NT_converter.h>
 
 #include <cmath>  // float comparison
 #include <limits>
 #include <string>
 #include <vector>
+#include <utility>  // std::pair
+#include <algorithm>  // std::find
 
 #include <gudhi/Alpha_complex.h>
 // to construct a simplex_tree from Delaunay_triangulation
@@ -271,3 +275,143 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_from_empty_points, TestedKernel, lis
   std::cout << "simplex_tree.num_vertices()=" << simplex_tree.num_vertices() << std::endl;
   BOOST_CHECK(simplex_tree.num_vertices() == 0);
 }
+
+// Simplicial complex without insert_sorted_simplices, as the models of the previous versions of
+// SimplicialComplexForAlpha
+struct Simplex_tree_without_bulk_insertion {
+  typedef Gudhi::Simplex_tree<>::Vertex_handle Vertex_handle;
+  typedef Gudhi::Simplex_tree<>::Filtration_value Filtration_value;
+
+  std::size_t num_vertices() { return simplex_tree.num_vertices(); }
+
+  void insert_simplex_and_subfaces(std::vector<Vertex_handle> const & vertex_range, Filtration_value filtration) {
+    simplex_tree.insert_simplex_and_subfaces(vertex_range, filtration);
+  }
+
+  Gudhi::Simplex_tree<> simplex_tree;
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_without_bulk_insertion, TestedKernel, list_of_kernel_variants) {
+  std::cout << "========== Alpha_complex_without_bulk_insertion ==========" << std::endl;
+
+  std::string off_file_name("alphacomplexdoc.off");
+  Gudhi::alpha_complex::Alpha_complex<TestedKernel> alpha_complex_from_file(off_file_name);
+
+  for (double max_alpha_square_value : {std::numeric_limits<double>::infinity(), 60.0, 10.0}) {
+    Gudhi::Simplex_tree<> simplex_tree;
+    BOOST_CHECK(alpha_complex_from_file.create_complex(simplex_tree, max_alpha_square_value));
+    Simplex_tree_without_bulk_insertion complex;
+    BOOST_CHECK(alpha_complex_from_file.create_complex(complex, max_alpha_square_value));
+
+    std::cout << "simplex_tree.num_simplices()=" << simplex_tree.num_simplices() << std::endl;
+    BOOST_CHECK(complex.simplex_tree == simplex_tree);
+  }
+}
+
+typedef CGAL::Epeck_d< CGAL::Dynamic_dimension_tag > Exact_kernel_d;
+typedef CGAL::Epeck_d< CGAL::Dimension_tag<3> > Exact_kernel_s;
+
+typedef boost::mpl::list<Kernel_d, Kernel_s, Exact_kernel_d, Exact_kernel_s> list_of_exact_and_inexact_kernel_variants;
+
+// Filtration values of the previous create_complex algorithm, on a simplex tree that contains the Delaunay complex:
+// the simplices get a NaN filtration value, then, by decreasing dimension, a simplex that is still NaN gets its squared
+// radius, and its faces get the minimum of the filtration values of their cofaces, or the filtration value of the first
+// coface for which they are not Gabriel.
+template<class Alpha_complex_type>
+void compute_filtration_by_nan_propagation(const Alpha_complex_type& alpha_complex, Gudhi::Simplex_tree<>& stree) {
+  typedef typename Alpha_complex_type::Geom_traits Kernel;
+  typedef Gudhi::Simplex_tree<>::Vertex_handle Vertex_handle;
+  Kernel kernel;
+  auto squared_radius = kernel.compute_squared_radius_d_object();
+  auto is_gabriel = kernel.side_of_bounded_sphere_d_object();
+  CGAL::NT_converter<typename Kernel::FT, double> cv;
+
+  for (auto f_simplex : stree.complex_simplex_range())
+    stree.assign_filtration(f_simplex, std::numeric_limits<double>::quiet_NaN());
+
+  std::vector<typename Alpha_complex_type::Point_d> points;
+  for (int decr_dim = stree.dimension(); decr_dim >= 0; decr_dim--) {
+    for (auto sigma : stree.skeleton_simplex_range(decr_dim)) {
+      if (stree.dimension(sigma) != decr_dim) continue;
+      if (std::isnan(stree.filtration(sigma))) {
+        double alpha_complex_filtration = 0.0;
+        if (decr_dim > 0) {
+          points.clear();
+          for (auto vertex : stree.simplex_vertex_range(sigma)) points.push_back(alpha_complex.get_point(vertex));
+          alpha_complex_filtration = cv(squared_radius(points.begin(), points.end()));
+        }
+        stree.assign_filtration(sigma, alpha_complex_filtration);
+      }
+      if (decr_dim < 2) continue;
+      for (auto tau : stree.boundary_simplex_range(sigma)) {
+        if (!std::isnan(stree.filtration(tau))) {
+          stree.assign_filtration(tau, std::fmin(stree.filtration(tau), stree.filtration(sigma)));
+          continue;
+        }
+        points.clear();
+        std::vector<Vertex_handle> tau_vertices;
+        for (auto vertex : stree.simplex_vertex_range(tau)) {
+          points.push_back(alpha_complex.get_point(vertex));
+          tau_vertices.push_back(vertex);
+        }
+        for (auto vertex : stree.simplex_vertex_range(sigma)) {
+          if (std::find(tau_vertices.begin(), tau_vertices.end(), vertex) != tau_vertices.end()) continue;
+          if (is_gabriel(points.begin(), points.end(), alpha_complex.get_point(vertex)) == CGAL::ON_BOUNDED_SIDE)
+            stree.assign_filtration(tau, stree.filtration(sigma));
+          break;
+        }
+      }
+    }
+  }
+  stree.make_filtration_non_decreasing();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_filtration_as_nan_propagation, TestedKernel,
+                              list_of_exact_and_inexact_kernel_variants) {
+  std::cout << "========== Alpha_complex_filtration_as_nan_propagation ==========" << std::endl;
+
+  std::string off_file_name("alphacomplexdoc.off");
+  Gudhi::alpha_complex::Alpha_complex<TestedKernel> alpha_complex_from_file(off_file_name);
+  Gudhi::Simplex_tree<> simplex_tree;
+  BOOST_CHECK(alpha_complex_from_file.create_complex(simplex_tree));
+
+  // Exact squared radii, cf. alphaoffreader_for_doc_60.txt
+  std::vector<std::pair<std::vector<int>, double>> expected_filtrations = {
+    {{0}, 0.}, {{1}, 0.}, {{2}, 0.}, {{3}, 0.}, {{4}, 0.}, {{5}, 0.}, {{6}, 0.},
+    {{2, 3}, 25. / 4.}, {{4, 5}, 29. / 4.}, {{0, 2}, 17. / 2.}, {{0, 1}, 37. / 4.}, {{1, 3}, 10.},
+    {{1, 2}, 45. / 4.}, {{1, 2, 3}, 25. / 2.}, {{0, 1, 2}, 3145. / 242.}, {{5, 6}, 53. / 4.}, {{2, 4}, 20.},
+    {{4, 6}, 7685. / 338.}, {{4, 5, 6}, 7685. / 338.}, {{3, 6}, 121. / 4.}, {{2, 6}, 73. / 2.},
+    {{2, 3, 6}, 73. / 2.}, {{2, 4, 6}, 1825. / 49.}, {{0, 4}, 7225. / 121.}, {{0, 2, 4}, 7225. / 121.}
+  };
+  std::cout << "simplex_tree.num_simplices()=" << simplex_tree.num_simplices() << std::endl;
+  BOOST_CHECK(simplex_tree.num_simplices() == expected_filtrations.size());
+  for (auto& simplex_and_filtration : expected_filtrations) {
+    auto f_simplex = simplex_tree.find(simplex_and_filtration.first);
+    BOOST_CHECK(f_simplex != simplex_tree.null_simplex());
+    if (f_simplex != simplex_tree.null_simplex())
+      GUDHI_TEST_FLOAT_EQUALITY_CHECK(simplex_tree.filtration(f_simplex), simplex_and_filtration.second, 1e-10);
+  }
+
+  // Same filtration values as the previous algorithm, before and after pruning
+  Gudhi::Simplex_tree<> reference(simplex_tree);
+  compute_filtration_by_nan_propagation(alpha_complex_from_file, reference);
+  for (double max_alpha_square_value : {std::numeric_limits<double>::infinity(), 59.0, 30.0}) {
+    Gudhi::Simplex_tree<> pruned_reference(reference);
+    pruned_reference.prune_above_filtration(max_alpha_square_value);
+    Gudhi::Simplex_tree<> pruned_simplex_tree;
+    BOOST_CHECK(alpha_complex_from_file.create_complex(pruned_simplex_tree, max_alpha_square_value));
+
+    std::cout << "alpha²=" << max_alpha_square_value << " - pruned_simplex_tree.num_simplices()="
+        << pruned_simplex_tree.num_simplices() << std::endl;
+    BOOST_CHECK(pruned_simplex_tree.num_simplices() == pruned_reference.num_simplices());
+    for (auto f_simplex : pruned_reference.complex_simplex_range()) {
+      std::vector<int> vertices;
+      for (auto vertex : pruned_reference.simplex_vertex_range(f_simplex)) vertices.push_back(vertex);
+      auto sh = pruned_simplex_tree.find(vertices);
+      BOOST_CHECK(sh != pruned_simplex_tree.null_simplex());
+      if (sh != pruned_simplex_tree.null_simplex())
+        GUDHI_TEST_FLOAT_EQUALITY_CHECK(pruned_simplex_tree.filtration(sh), pruned_reference.filtration(f_simplex),
+                                        1e-10);
+    }
+  }
+}
@@ -0,0 +1,107 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Bitmap_cubical_complex_persistence.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdlib>  // for std::atoi
+#include <cstddef>  // for std::size_t
+
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Bitmap_cubical_complex_base = Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>;
+using Periodic_bitmap_cubical_complex_base =
+    Gudhi::cubical_complex::Bitmap_cubical_complex_periodic_boundary_conditions_base<double>;
+
+template <typename Bitmap_base>
+Bitmap_base make_bitmap(const std::vector<unsigned>& sizes, const std::vector<double>& data,
+                        const std::vector<bool>& periodic);
+
+template <>
+Bitmap_cubical_complex_base make_bitmap(const std::vector<unsigned>& sizes, const std::vector<double>& data,
+                                        const std::vector<bool>&) {
+  return Bitmap_cubical_complex_base(sizes, data);
+}
+
+template <>
+Periodic_bitmap_cubical_complex_base make_bitmap(const std::vector<unsigned>& sizes, const std::vector<double>& data,
+                                                 const std::vector<bool>& periodic) {
+  return Periodic_bitmap_cubical_complex_base(sizes, data, periodic);
+}
+
+/* Builds the cubical complex of the bitmap, iterates on all the boundaries, first with the vectors of
+ * get_boundary_of_a_cell then with the ranges of boundary_simplex_range, and computes the persistence diagram, as in
+ * cubical_complex_persistence, then with compute_persistence_diagrams, as in cubical_complex_fast_persistence. */
+template <typename Bitmap_base>
+void timing_persistence(const std::string& msg, const std::vector<unsigned>& sizes, const std::vector<double>& data,
+                        const std::vector<bool>& periodic) {
+  using Bitmap_cubical_complex = Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_base>;
+  std::cout << msg << std::endl;
+
+  Gudhi::Clock construction_clock("  Construct the complex");
+  Bitmap_cubical_complex b(sizes, data, periodic);
+  std::cout << construction_clock;
+
+  Gudhi::Clock vector_clock("  Iterate on the boundaries with get_boundary_of_a_cell");
+  std::size_t num_faces = 0;
+  for (std::size_t cell = 0; cell != b.num_simplices(); ++cell)
+    for (auto face : b.get_boundary_of_a_cell(cell)) num_faces += face & 1;
+  std::cout << vector_clock;
+
+  Gudhi::Clock range_clock("  Iterate on the boundaries with boundary_simplex_range");
+  std::size_t num_faces_range = 0;
+  for (std::size_t cell = 0; cell != b.num_simplices(); ++cell)
+    for (auto face : b.boundary_simplex_range(cell)) num_faces_range += face & 1;
+  std::cout << range_clock;
+  if (num_faces != num_faces_range) std::cerr << "  Different boundaries!" << std::endl;
+
+  Gudhi::Clock persistence_clock("  Persistent_cohomology");
+  Gudhi::persistent_cohomology::Persistent_cohomology<Bitmap_cubical_complex, Field_Zp> pcoh(b, true);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology(0);
+  std::cout << persistence_clock;
+
+  // Without the Bitmap_cubical_complex layer, which sorts all the cells when it is constructed.
+  Gudhi::Clock base_clock("  Construct the bitmap");
+  Bitmap_base base = make_bitmap<Bitmap_base>(sizes, data, periodic);
+  std::cout << base_clock;
+
+  Gudhi::Clock fast_clock("  compute_persistence_diagrams");
+  auto diagrams = Gudhi::cubical_complex::compute_persistence_diagrams(base);
+  std::cout << fast_clock;
+  for (std::size_t dim = 0; dim != diagrams.size(); ++dim) {
+    if (diagrams[dim].size() != pcoh.intervals_in_dimension(dim).size())
+      std::cerr << "  Different number of intervals in dimension " << dim << "!" << std::endl;
+  }
+}
+
+/* Persistence of a random 3d image, with and without periodic boundary conditions.
+ * Usage: cubical_complex_persistence_benchmark [size [seed]] */
+int main(int argc, char* argv[]) {
+  unsigned size = 64;
+  unsigned seed = 42;
+  if (argc > 1) size = std::atoi(argv[1]);
+  if (argc > 2) seed = std::atoi(argv[2]);
+
+  std::vector<unsigned> sizes(3, size);
+  std::vector<double> data(static_cast<std::size_t>(size) * size * size);
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  for (double& value : data) value = dist(gen);
+
+  std::cout << "Random image of size " << size << "^3" << std::endl;
+  timing_persistence<Bitmap_cubical_complex_base>("Bitmap_cubical_complex_base", sizes, data,
+                                                  std::vector<bool>(3, false));
+  timing_persistence<Periodic_bitmap_cubical_complex_base>("Bitmap_cubical_complex_periodic_boundary_conditions_base",
+                                                           sizes, data, std::vector<bool>(3, true));
+  return 0;
+}
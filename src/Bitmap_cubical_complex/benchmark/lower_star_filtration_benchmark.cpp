@@ -0,0 +1,86 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Bitmap_cubical_complex_base.h>
+#include <gudhi/Bitmap_cubical_complex_periodic_boundary_conditions_base.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdlib>  // for std::atoi
+#include <cstddef>  // for std::size_t
+
+using Bitmap_cubical_complex_base = Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>;
+using Periodic_bitmap_cubical_complex_base =
+    Gudhi::cubical_complex::Bitmap_cubical_complex_periodic_boundary_conditions_base<double>;
+
+/* The lower star filtration computed from the top dimensional cells down, by propagating the values of the cells of
+ * each dimension to their boundaries, which is how impose_lower_star_filtration used to work. */
+template <typename Bitmap_base>
+void propagate_to_boundaries(Bitmap_base& b) {
+  std::vector<bool> is_considered(b.size(), false);
+  std::vector<std::size_t> cells;
+  for (auto cell : b.top_dimensional_cells_range()) cells.push_back(cell);
+  while (!cells.empty()) {
+    std::vector<std::size_t> faces;
+    for (std::size_t cell : cells) {
+      for (std::size_t face : b.boundary_range(cell)) {
+        if (b.get_cell_data(face) > b.get_cell_data(cell)) b.get_cell_data(face) = b.get_cell_data(cell);
+        if (!is_considered[face]) {
+          faces.push_back(face);
+          is_considered[face] = true;
+        }
+      }
+    }
+    cells.swap(faces);
+  }
+}
+
+template <typename Bitmap_base>
+void timing_lower_star_filtration(const std::string& msg, const Bitmap_base& bitmap) {
+  std::cout << msg << std::endl;
+
+  Bitmap_base propagated = bitmap;
+  Gudhi::Clock propagation_clock("  Propagate the values to the boundaries");
+  propagate_to_boundaries(propagated);
+  std::cout << propagation_clock;
+
+  Bitmap_base swept = bitmap;
+  Gudhi::Clock sweep_clock("  impose_lower_star_filtration");
+  swept.impose_lower_star_filtration();
+  std::cout << sweep_clock;
+
+  for (std::size_t cell = 0; cell != bitmap.size(); ++cell) {
+    if (propagated.get_cell_data(cell) != swept.get_cell_data(cell)) {
+      std::cerr << "  Different filtration values!" << std::endl;
+      break;
+    }
+  }
+}
+
+/* Lower star filtration of a random 3d image, with and without periodic boundary conditions.
+ * Usage: lower_star_filtration_benchmark [size [seed]] */
+int main(int argc, char* argv[]) {
+  unsigned size = 128;
+  unsigned seed = 42;
+  if (argc > 1) size = std::atoi(argv[1]);
+  if (argc > 2) seed = std::atoi(argv[2]);
+
+  std::vector<unsigned> sizes(3, size);
+  std::vector<double> data(static_cast<std::size_t>(size) * size * size);
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  for (double& value : data) value = dist(gen);
+
+  std::cout << "Random image of size " << size << "^3" << std::endl;
+  timing_lower_star_filtration("Bitmap_cubical_complex_base", Bitmap_cubical_complex_base(sizes, data));
+  timing_lower_star_filtration("Bitmap_cubical_complex_periodic_boundary_conditions_base",
+                               Periodic_bitmap_cubical_complex_base(sizes, data, std::vector<bool>(3, true)));
+  return 0;
+}
@@ -97,6 +97,17 @@ namespace cubical_complex {
  * from the file Bitmap_cubical_complex_periodic_boundary_conditions_base.h to construct cubical complex with periodic
  * boundary conditions. One can also use Perseus style input files (see \ref FileFormatsPerseus).
  *
+ * \section CubicalPersistence Persistence
+ * The persistent homology of a `Bitmap_cubical_complex` can be computed with
+ * `Gudhi::persistent_cohomology::Persistent_cohomology`, like any filtered complex. For large images,
+ * `compute_persistence_diagrams()` is a faster alternative, with coefficients in \f$\mathbb{Z}/2\mathbb{Z}\f$, that
+ * works directly on `Bitmap_cubical_complex_base` or `Bitmap_cubical_complex_periodic_boundary_conditions_base`. It
+ * does not sort all the cells in a common filtration order, computes the intervals of dimension 0 and of the top
+ * dimension with union-find data structures, and reduces the boundary matrix only for the other dimensions.
+ * On top of the bitmap itself, it stores for each cell its position and its rank among the cells of its dimension,
+ * i.e. about 8 bytes per cell (16 bytes when the complex has more than \f$2^{32}\f$ cells), so the whole complex
+ * must fit in memory at that cost.
+ *
  * \section BitmapExamples Examples
  * End user programs are available in example/Bitmap_cubical_complex and utilities/Bitmap_cubical_complex folders.
  * 
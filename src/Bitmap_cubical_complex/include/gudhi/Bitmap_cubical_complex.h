@@ -25,6 +25,7 @@
 #include <algorithm>  // for sort
 #include <vector>
 #include <numeric>  // for iota
+#include <iterator>  // for next
 #include <cstddef>
 
 namespace Gudhi {
@@ -232,8 +233,8 @@ class Bitmap_cubical_complex : public T {
   /**
    * Boundary_simplex_range class provides ranges for boundary iterators.
    **/
-  typedef typename std::vector<Simplex_handle>::iterator Boundary_simplex_iterator;
-  typedef typename std::vector<Simplex_handle> Boundary_simplex_range;
+  typedef typename T::Boundary_iterator Boundary_simplex_iterator;
+  typedef typename T::Boundary_range Boundary_simplex_range;
 
   /**
    * Filtration_simplex_iterator class provides an iterator though the whole structure in the order of filtration.
@@ -341,7 +342,7 @@ class Bitmap_cubical_complex : public T {
    * boundary_simplex_range creates an object of a Boundary_simplex_range class
    * that provides ranges for the Boundary_simplex_iterator.
    **/
-  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) { return this->get_boundary_of_a_cell(sh); }
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) { return this->boundary_range(sh); }
 
   /**
    * filtration_simplex_range creates an object of a Filtration_simplex_range class
@@ -370,17 +371,17 @@ class Bitmap_cubical_complex : public T {
    * Function needed for compatibility with Gudhi. Not useful for other purposes.
    **/
   std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) {
-    std::vector<std::size_t> bdry = this->get_boundary_of_a_cell(sh);
+    Boundary_simplex_range bdry = this->boundary_range(sh);
     if (globalDbg) {
       std::cerr << "std::pair<Simplex_handle, Simplex_handle> endpoints( Simplex_handle sh )\n";
-      std::cerr << "bdry.size() : " << bdry.size() << "\n";
     }
     // this method returns two first elements from the boundary of sh.
-    if (bdry.size() < 2)
+    Boundary_simplex_iterator it = bdry.begin();
+    if ((it == bdry.end()) || (std::next(it) == bdry.end()))
       throw(
           "Error in endpoints in Bitmap_cubical_complex class. The cell have less than two elements in the "
           "boundary.");
-    return std::make_pair(bdry[0], bdry[1]);
+    return std::make_pair(*it, *std::next(it));
   }
 
   /**
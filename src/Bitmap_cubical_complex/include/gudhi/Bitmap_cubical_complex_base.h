@@ -15,6 +15,13 @@
 
 #include <gudhi/Bitmap_cubical_complex/counter.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
 #include <iostream>
 #include <vector>
 #include <string>
@@ -93,6 +100,7 @@ class Bitmap_cubical_complex_base {
    * the positions of (co)boundary element of the input cell.
    * The boundary elements are guaranteed to be returned so that the
    * incidence coefficients of boundary elements are alternating.
+   * boundary_range gives the same elements without allocating a vector.
    */
   virtual inline std::vector<std::size_t> get_boundary_of_a_cell(std::size_t cell) const;
   /**
@@ -107,6 +115,7 @@ class Bitmap_cubical_complex_base {
    * positions of (co)boundary element of the input cell.
    * Note that unlike in the case of boundary, over here the elements are
    * not guaranteed to be returned with alternating incidence numbers.
+   * coboundary_range gives the same elements without allocating a vector.
    *
    **/
   virtual inline std::vector<std::size_t> get_coboundary_of_a_cell(std::size_t cell) const;
@@ -131,32 +140,33 @@ class Bitmap_cubical_complex_base {
   * dimensional face of a cube \f$A\f$.
   **/
   virtual int compute_incidence_between_cells(std::size_t coface, std::size_t face) const {
-    // first get the counters for coface and face:
-    std::vector<unsigned> coface_counter = this->compute_counter_for_given_cell(coface);
-    std::vector<unsigned> face_counter = this->compute_counter_for_given_cell(face);
-
-    // coface_counter and face_counter should agree at all positions except from one:
+    // the positions of coface and face should agree in all directions except from one:
     int number_of_position_in_which_counters_do_not_agree = -1;
+    unsigned coface_position_in_this_direction = 0;
+    unsigned face_position_in_this_direction = 0;
     std::size_t number_of_full_faces_that_comes_before = 0;
-    for (std::size_t i = 0; i != coface_counter.size(); ++i) {
-      if ((coface_counter[i] % 2 == 1) && (number_of_position_in_which_counters_do_not_agree == -1)) {
+    for (std::size_t i = 0; i != this->multipliers.size(); ++i) {
+      unsigned coface_position = this->position_in_direction(coface, i);
+      unsigned face_position = this->position_in_direction(face, i);
+      if ((coface_position % 2 == 1) && (number_of_position_in_which_counters_do_not_agree == -1)) {
         ++number_of_full_faces_that_comes_before;
       }
-      if (coface_counter[i] != face_counter[i]) {
+      if (coface_position != face_position) {
         if (number_of_position_in_which_counters_do_not_agree != -1) {
           std::cout << "Cells given to compute_incidence_between_cells procedure do not form a pair of coface-face.\n";
           throw std::logic_error(
               "Cells given to compute_incidence_between_cells procedure do not form a pair of coface-face.");
         }
         number_of_position_in_which_counters_do_not_agree = i;
+        coface_position_in_this_direction = coface_position;
+        face_position_in_this_direction = face_position;
       }
     }
 
     int incidence = 1;
     if (number_of_full_faces_that_comes_before % 2) incidence = -1;
     // if the face cell is on the right from coface cell:
-    if (coface_counter[number_of_position_in_which_counters_do_not_agree] + 1 ==
-        face_counter[number_of_position_in_which_counters_do_not_agree]) {
+    if (coface_position_in_this_direction + 1 == face_position_in_this_direction) {
       incidence *= -1;
     }
 
@@ -181,6 +191,11 @@ class Bitmap_cubical_complex_base {
    **/
   inline T& get_cell_data(std::size_t cell);
 
+  /**
+   * Returns the value of the filtration of a cube in a given position, without allowing to modify it.
+   **/
+  inline const T& get_cell_data(std::size_t cell) const { return this->data[cell]; }
+
   /**
    * Typical input used to construct a baseBitmap class is a filtration given at the top dimensional cells.
    * Then, there are a few ways one can pick the filtration of lower dimensional
@@ -317,29 +332,136 @@ class Bitmap_cubical_complex_base {
 
   All_cells_range all_cells_range() { return All_cells_range(this); }
 
+  /**
+   * @brief Iterator through the boundary (if `boundary` is true) or the coboundary of a cell.
+   * @details The (co)boundary elements are computed on the fly, in the same order as in get_boundary_of_a_cell and
+   * get_coboundary_of_a_cell, but without allocating memory. The elements in each direction are given by the
+   * functions boundary_in_direction and coboundary_in_direction of the class `Bitmap`, which are resolved at compile
+   * time, so that a class with other boundary conditions only has to provide those two functions.
+   **/
+  template <class Bitmap, bool boundary>
+  class Cell_neighbours_iterator
+      : public boost::iterator_facade<Cell_neighbours_iterator<Bitmap, boundary>, std::size_t const,
+                                      boost::forward_traversal_tag, std::size_t> {
+   public:
+    Cell_neighbours_iterator()
+        : b(nullptr), cell(0), remainder(0), direction(0), sum_of_dimensions(0), count(0), current(0) {}
+
+    Cell_neighbours_iterator(const Bitmap* b, std::size_t cell)
+        : b(b),
+          cell(cell),
+          remainder(cell),
+          direction(b->multipliers.size()),
+          sum_of_dimensions(0),
+          count(0),
+          current(0) {
+      this->find_next_direction();
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+
+    std::size_t dereference() const { return this->elements[this->current]; }
+
+    bool equal(const Cell_neighbours_iterator& other) const {
+      return (this->direction == other.direction) && (this->count == other.count) &&
+             (this->current == other.current);
+    }
+
+    void increment() {
+      if (++this->current == this->count) this->find_next_direction();
+    }
+
+    // Looks for the next direction, in decreasing order, in which the cell has (co)boundary elements.
+    void find_next_direction() {
+      this->current = 0;
+      this->count = 0;
+      while ((this->count == 0) && (this->direction != 0)) {
+        --this->direction;
+        std::size_t multiplier = this->b->multipliers[this->direction];
+        unsigned position = this->remainder / multiplier;
+        this->remainder = this->remainder % multiplier;
+        if (boundary) {
+          if (position % 2 == 1) {
+            this->count = this->b->boundary_in_direction(this->cell, this->direction, position,
+                                                         this->sum_of_dimensions % 2 == 1, this->elements);
+            ++this->sum_of_dimensions;
+          }
+        } else if (position % 2 == 0) {
+          this->count = this->b->coboundary_in_direction(this->cell, this->direction, position, this->elements);
+        }
+      }
+    }
+
+    const Bitmap* b;
+    std::size_t cell;
+    std::size_t remainder;
+    std::size_t direction;
+    std::size_t sum_of_dimensions;
+    std::size_t elements[2];
+    unsigned count;
+    unsigned current;
+  };
+
   /**
    * Boundary_range class provides ranges for boundary iterators.
    **/
-  typedef typename std::vector<std::size_t>::const_iterator Boundary_iterator;
-  typedef typename std::vector<std::size_t> Boundary_range;
+  typedef Cell_neighbours_iterator<Bitmap_cubical_complex_base, true> Boundary_iterator;
+  typedef boost::iterator_range<Boundary_iterator> Boundary_range;
+
+  /**
+   * boundary_range creates an object of a Boundary_range class
+   * that provides ranges for the Boundary_iterator.
+   **/
+  Boundary_range boundary_range(std::size_t sh) const {
+    return Boundary_range(Boundary_iterator(this, sh), Boundary_iterator());
+  }
 
   /**
-   * boundary_simplex_range creates an object of a Boundary_simplex_range class
-   * that provides ranges for the Boundary_simplex_iterator.
+   * Coboundary_range class provides ranges for coboundary iterators.
    **/
-  Boundary_range boundary_range(std::size_t sh) { return this->get_boundary_of_a_cell(sh); }
+  typedef Cell_neighbours_iterator<Bitmap_cubical_complex_base, false> Coboundary_iterator;
+  typedef boost::iterator_range<Coboundary_iterator> Coboundary_range;
 
   /**
-   * Coboundary_range class provides ranges for boundary iterators.
+   * coboundary_range creates an object of a Coboundary_range class
+   * that provides ranges for the Coboundary_iterator.
    **/
-  typedef typename std::vector<std::size_t>::const_iterator Coboundary_iterator;
-  typedef typename std::vector<std::size_t> Coboundary_range;
+  Coboundary_range coboundary_range(std::size_t sh) const {
+    return Coboundary_range(Coboundary_iterator(this, sh), Coboundary_iterator());
+  }
 
   /**
-   * boundary_simplex_range creates an object of a Boundary_simplex_range class
-   * that provides ranges for the Boundary_simplex_iterator.
+   * Writes in `elements` the boundary elements of the cell in the direction i, in which the cell is at the (odd)
+   * position `position`, and returns their number. `odd` is true when the cell has an odd number of nonzero length
+   * directions after the direction i.
    **/
-  Coboundary_range coboundary_range(std::size_t sh) { return this->get_coboundary_of_a_cell(sh); }
+  unsigned boundary_in_direction(std::size_t cell, std::size_t i, unsigned /* position */, bool odd,
+                                 std::size_t* elements) const {
+    if (odd) {
+      elements[0] = cell + this->multipliers[i];
+      elements[1] = cell - this->multipliers[i];
+    } else {
+      elements[0] = cell - this->multipliers[i];
+      elements[1] = cell + this->multipliers[i];
+    }
+    return 2;
+  }
+
+  /**
+   * Writes in `elements` the coboundary elements of the cell in the direction i, in which the cell is at the (even)
+   * position `position`, and returns their number.
+   **/
+  unsigned coboundary_in_direction(std::size_t cell, std::size_t i, unsigned position, std::size_t* elements) const {
+    unsigned count = 0;
+    if ((cell > this->multipliers[i]) && (position != 0)) {
+      elements[count++] = cell - this->multipliers[i];
+    }
+    if ((cell + this->multipliers[i] < this->data.size()) && (position != 2 * this->sizes[i])) {
+      elements[count++] = cell + this->multipliers[i];
+    }
+    return count;
+  }
 
   /**
    * @brief Iterator through top dimensional cells of the complex. The cells appear in order they are stored
@@ -494,6 +616,17 @@ class Bitmap_cubical_complex_base {
     return position;
   }
 
+  // The i-th element of compute_counter_for_given_cell(cell), without computing the others.
+  unsigned position_in_direction(std::size_t cell, std::size_t i) const {
+    if (i + 1 != this->multipliers.size()) cell = cell % this->multipliers[i + 1];
+    return cell / this->multipliers[i];
+  }
+
+  // cells[k] = min(cells[k], neighbours[k]) for k < count, on contiguous memory so that it can be vectorized.
+  static void min_in_place(T* cells, const T* neighbours, std::size_t count) {
+    for (std::size_t k = 0; k != count; ++k) cells[k] = std::min(cells[k], neighbours[k]);
+  }
+
   std::vector<unsigned> compute_counter_for_given_cell(std::size_t cell) const {
     std::vector<unsigned> counter;
     counter.reserve(this->sizes.size());
@@ -708,48 +841,19 @@ Bitmap_cubical_complex_base<T>::Bitmap_cubical_complex_base(const char* perseus_
 
 template <typename T>
 std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_boundary_of_a_cell(std::size_t cell) const {
+  Boundary_range boundary = this->boundary_range(cell);
   std::vector<std::size_t> boundary_elements;
-
-  // Speed traded of for memory. Check if it is better in practice.
   boundary_elements.reserve(this->dimension() * 2);
-
-  std::size_t sum_of_dimensions = 0;
-  std::size_t cell1 = cell;
-  for (std::size_t i = this->multipliers.size(); i != 0; --i) {
-    unsigned position = cell1 / this->multipliers[i - 1];
-    if (position % 2 == 1) {
-      if (sum_of_dimensions % 2) {
-        boundary_elements.push_back(cell + this->multipliers[i - 1]);
-        boundary_elements.push_back(cell - this->multipliers[i - 1]);
-      } else {
-        boundary_elements.push_back(cell - this->multipliers[i - 1]);
-        boundary_elements.push_back(cell + this->multipliers[i - 1]);
-      }
-      ++sum_of_dimensions;
-    }
-    cell1 = cell1 % this->multipliers[i - 1];
-  }
-
+  for (std::size_t element : boundary) boundary_elements.push_back(element);
   return boundary_elements;
 }
 
 template <typename T>
 std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_coboundary_of_a_cell(std::size_t cell) const {
-  std::vector<unsigned> counter = this->compute_counter_for_given_cell(cell);
+  Coboundary_range coboundary = this->coboundary_range(cell);
   std::vector<std::size_t> coboundary_elements;
-  std::size_t cell1 = cell;
-  for (std::size_t i = this->multipliers.size(); i != 0; --i) {
-    unsigned position = cell1 / this->multipliers[i - 1];
-    if (position % 2 == 0) {
-      if ((cell > this->multipliers[i - 1]) && (counter[i - 1] != 0)) {
-        coboundary_elements.push_back(cell - this->multipliers[i - 1]);
-      }
-      if ((cell + this->multipliers[i - 1] < this->data.size()) && (counter[i - 1] != 2 * this->sizes[i - 1])) {
-        coboundary_elements.push_back(cell + this->multipliers[i - 1]);
-      }
-    }
-    cell1 = cell1 % this->multipliers[i - 1];
-  }
+  coboundary_elements.reserve(this->dimension() * 2);
+  for (std::size_t element : coboundary) coboundary_elements.push_back(element);
   return coboundary_elements;
 }
 
@@ -784,55 +888,55 @@ inline T& Bitmap_cubical_complex_base<T>::get_cell_data(std::size_t cell) {
 
 template <typename T>
 void Bitmap_cubical_complex_base<T>::impose_lower_star_filtration() {
-  bool dbg = false;
-
-  // this vector will be used to check which elements have already been taken care of in imposing lower star filtration
-  std::vector<bool> is_this_cell_considered(this->data.size(), false);
-
-  std::size_t size_to_reserve = 1;
+  // The value of a cell becomes the minimum of the values of the cells that contain it, which, in each direction in
+  // which the cell has length zero, are the cells just before and just after it. This minimum is computed with one
+  // pass per direction, where the cells at even positions take the minimum with their neighbours in this direction.
+  T* const cells = this->data.data();
   for (std::size_t i = 0; i != this->multipliers.size(); ++i) {
-    size_to_reserve *= (std::size_t)((this->multipliers[i] - 1) / 2);
-  }
-
-  std::vector<std::size_t> indices_to_consider;
-  indices_to_consider.reserve(size_to_reserve);
-  // we assume here that we already have a filtration on the top dimensional cells and
-  // we have to extend it to lower ones.
-  typename Bitmap_cubical_complex_base<T>::Top_dimensional_cells_iterator it(*this);
-  for (it = this->top_dimensional_cells_iterator_begin(); it != this->top_dimensional_cells_iterator_end(); ++it) {
-    indices_to_consider.push_back(it.compute_index_in_bitmap());
-  }
-
-  while (indices_to_consider.size()) {
-    if (dbg) {
-      std::cerr << "indices_to_consider in this iteration \n";
-      for (std::size_t i = 0; i != indices_to_consider.size(); ++i) {
-        std::cout << indices_to_consider[i] << "  ";
-      }
-    }
-    std::vector<std::size_t> new_indices_to_consider;
-    for (std::size_t i = 0; i != indices_to_consider.size(); ++i) {
-      std::vector<std::size_t> bd = this->get_boundary_of_a_cell(indices_to_consider[i]);
-      for (std::size_t boundaryIt = 0; boundaryIt != bd.size(); ++boundaryIt) {
-        if (dbg) {
-          std::cerr << "filtration of a cell : " << bd[boundaryIt] << " is : " << this->data[bd[boundaryIt]]
-                    << " while of a cell: " << indices_to_consider[i] << " is: " << this->data[indices_to_consider[i]]
-                    << std::endl;
-        }
-        if (this->data[bd[boundaryIt]] > this->data[indices_to_consider[i]]) {
-          this->data[bd[boundaryIt]] = this->data[indices_to_consider[i]];
-          if (dbg) {
-            std::cerr << "Setting the value of a cell : " << bd[boundaryIt]
-                      << " to : " << this->data[indices_to_consider[i]] << std::endl;
-          }
-        }
-        if (is_this_cell_considered[bd[boundaryIt]] == false) {
-          new_indices_to_consider.push_back(bd[boundaryIt]);
-          is_this_cell_considered[bd[boundaryIt]] = true;
-        }
-      }
+    const std::size_t multiplier = this->multipliers[i];
+    const std::size_t slab_size = (i + 1 != this->multipliers.size()) ? this->multipliers[i + 1] : this->data.size();
+    const std::size_t number_of_slabs = this->data.size() / slab_size;
+    const std::size_t number_of_positions = slab_size / multiplier;
+    // With periodic boundary conditions, there is no vertex at the last position, and the first vertex is after the
+    // last edge.
+    const bool periodic = (number_of_positions % 2 == 0);
+
+    if (multiplier == 1) {
+      // A slab is a line of consecutive cells.
+      auto process_line = [&](std::size_t slab) {
+        T* line = cells + slab * slab_size;
+        for (std::size_t position = 2; position + 1 < number_of_positions; position += 2)
+          line[position] = std::min(line[position], std::min(line[position - 1], line[position + 1]));
+        if (number_of_positions == 1) return;
+        line[0] = std::min(line[0], line[1]);
+        if (periodic)
+          line[0] = std::min(line[0], line[number_of_positions - 1]);
+        else
+          line[number_of_positions - 1] = std::min(line[number_of_positions - 1], line[number_of_positions - 2]);
+      };
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), number_of_slabs, process_line);
+#else
+      for (std::size_t slab = 0; slab != number_of_slabs; ++slab) process_line(slab);
+#endif
+    } else {
+      // The cells at the same position in this direction form contiguous rows of multiplier cells.
+      const std::size_t number_of_rows = (number_of_positions + 1) / 2;
+      auto process_row = [&](std::size_t row) {
+        std::size_t position = 2 * (row % number_of_rows);
+        T* first = cells + (row / number_of_rows) * slab_size + position * multiplier;
+        if (position != 0)
+          this->min_in_place(first, first - multiplier, multiplier);
+        else if (periodic)
+          this->min_in_place(first, first + (number_of_positions - 1) * multiplier, multiplier);
+        if (position + 1 != number_of_positions) this->min_in_place(first, first + multiplier, multiplier);
+      };
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), number_of_slabs * number_of_rows, process_row);
+#else
+      for (std::size_t row = 0; row != number_of_slabs * number_of_rows; ++row) process_row(row);
+#endif
     }
-    indices_to_consider.swap(new_indices_to_consider);
   }
 }
 
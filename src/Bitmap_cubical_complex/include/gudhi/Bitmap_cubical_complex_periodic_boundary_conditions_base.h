@@ -15,6 +15,8 @@
 
 #include <gudhi/Bitmap_cubical_complex_base.h>
 
+#include <boost/range/iterator_range.hpp>
+
 #include <cmath>
 #include <limits>  // for numeric_limits<>
 #include <vector>
@@ -117,40 +119,119 @@ class Bitmap_cubical_complex_periodic_boundary_conditions_base : public Bitmap_c
   * dimensional face of a cube \f$A\f$.
   **/
   virtual int compute_incidence_between_cells(std::size_t coface, std::size_t face) {
-    // first get the counters for coface and face:
-    std::vector<unsigned> coface_counter = this->compute_counter_for_given_cell(coface);
-    std::vector<unsigned> face_counter = this->compute_counter_for_given_cell(face);
-
-    // coface_counter and face_counter should agree at all positions except from one:
+    // the positions of coface and face should agree in all directions except from one:
     int number_of_position_in_which_counters_do_not_agree = -1;
+    unsigned coface_position_in_this_direction = 0;
+    unsigned face_position_in_this_direction = 0;
     std::size_t number_of_full_faces_that_comes_before = 0;
-    for (std::size_t i = 0; i != coface_counter.size(); ++i) {
-      if ((coface_counter[i] % 2 == 1) && (number_of_position_in_which_counters_do_not_agree == -1)) {
+    for (std::size_t i = 0; i != this->multipliers.size(); ++i) {
+      unsigned coface_position = this->position_in_direction(coface, i);
+      unsigned face_position = this->position_in_direction(face, i);
+      if ((coface_position % 2 == 1) && (number_of_position_in_which_counters_do_not_agree == -1)) {
         ++number_of_full_faces_that_comes_before;
       }
-      if (coface_counter[i] != face_counter[i]) {
+      if (coface_position != face_position) {
         if (number_of_position_in_which_counters_do_not_agree != -1) {
           std::cout << "Cells given to compute_incidence_between_cells procedure do not form a pair of coface-face.\n";
           throw std::logic_error(
               "Cells given to compute_incidence_between_cells procedure do not form a pair of coface-face.");
         }
         number_of_position_in_which_counters_do_not_agree = i;
+        coface_position_in_this_direction = coface_position;
+        face_position_in_this_direction = face_position;
       }
     }
 
     int incidence = 1;
     if (number_of_full_faces_that_comes_before % 2) incidence = -1;
     // if the face cell is on the right from coface cell:
-    if ((coface_counter[number_of_position_in_which_counters_do_not_agree] + 1 ==
-         face_counter[number_of_position_in_which_counters_do_not_agree]) ||
-        ((coface_counter[number_of_position_in_which_counters_do_not_agree] != 1) &&
-         (face_counter[number_of_position_in_which_counters_do_not_agree] == 0))) {
+    if ((coface_position_in_this_direction + 1 == face_position_in_this_direction) ||
+        ((coface_position_in_this_direction != 1) && (face_position_in_this_direction == 0))) {
       incidence *= -1;
     }
 
     return incidence;
   }
 
+  /**
+   * Boundary_range class provides ranges for boundary iterators, with the periodic boundary conditions.
+   **/
+  typedef typename Bitmap_cubical_complex_base<T>::template Cell_neighbours_iterator<
+      Bitmap_cubical_complex_periodic_boundary_conditions_base, true>
+      Boundary_iterator;
+  typedef boost::iterator_range<Boundary_iterator> Boundary_range;
+
+  /**
+   * boundary_range creates an object of a Boundary_range class
+   * that provides ranges for the Boundary_iterator.
+   **/
+  Boundary_range boundary_range(std::size_t sh) const {
+    return Boundary_range(Boundary_iterator(this, sh), Boundary_iterator());
+  }
+
+  /**
+   * Coboundary_range class provides ranges for coboundary iterators, with the periodic boundary conditions.
+   **/
+  typedef typename Bitmap_cubical_complex_base<T>::template Cell_neighbours_iterator<
+      Bitmap_cubical_complex_periodic_boundary_conditions_base, false>
+      Coboundary_iterator;
+  typedef boost::iterator_range<Coboundary_iterator> Coboundary_range;
+
+  /**
+   * coboundary_range creates an object of a Coboundary_range class
+   * that provides ranges for the Coboundary_iterator.
+   **/
+  Coboundary_range coboundary_range(std::size_t sh) const {
+    return Coboundary_range(Coboundary_iterator(this, sh), Coboundary_iterator());
+  }
+
+  /**
+   * A version of Bitmap_cubical_complex_base::boundary_in_direction with the periodic boundary conditions.
+   **/
+  unsigned boundary_in_direction(std::size_t cell, std::size_t i, unsigned position, bool odd,
+                                 std::size_t* elements) const {
+    std::size_t before = cell - this->multipliers[i];
+    std::size_t after = cell + this->multipliers[i];
+    // in a direction with boundary conditions, the last cell is glued to the first vertex.
+    if (directions_in_which_periodic_b_cond_are_to_be_imposed[i] && (position == 2 * this->sizes[i] - 1)) {
+      after = cell - (2 * this->sizes[i] - 1) * this->multipliers[i];
+    }
+    if (odd) {
+      elements[0] = before;
+      elements[1] = after;
+    } else {
+      elements[0] = after;
+      elements[1] = before;
+    }
+    return 2;
+  }
+
+  /**
+   * A version of Bitmap_cubical_complex_base::coboundary_in_direction with the periodic boundary conditions.
+   **/
+  unsigned coboundary_in_direction(std::size_t cell, std::size_t i, unsigned position, std::size_t* elements) const {
+    if (!directions_in_which_periodic_b_cond_are_to_be_imposed[i]) {
+      // no periodic boundary conditions in this direction
+      unsigned count = 0;
+      if ((position != 0) && (cell > this->multipliers[i])) {
+        elements[count++] = cell - this->multipliers[i];
+      }
+      if ((position != 2 * this->sizes[i]) && (cell + this->multipliers[i] < this->data.size())) {
+        elements[count++] = cell + this->multipliers[i];
+      }
+      return count;
+    }
+    // we want to have periodic boundary conditions in this direction
+    if (position != 0) {
+      elements[0] = cell - this->multipliers[i];
+      elements[1] = cell + this->multipliers[i];
+    } else {
+      elements[0] = cell + this->multipliers[i];
+      elements[1] = cell + (2 * this->sizes[i] - 1) * this->multipliers[i];
+    }
+    return 2;
+  }
+
  protected:
   std::vector<bool> directions_in_which_periodic_b_cond_are_to_be_imposed;
 
@@ -278,102 +359,20 @@ Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::Bitmap_cubical_comp
 template <typename T>
 std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::get_boundary_of_a_cell(
     std::size_t cell) const {
-  bool dbg = false;
-  if (dbg) {
-    std::cerr << "Computations of boundary of a cell : " << cell << std::endl;
-  }
-
+  Boundary_range boundary = this->boundary_range(cell);
   std::vector<std::size_t> boundary_elements;
   boundary_elements.reserve(this->dimension() * 2);
-  std::size_t cell1 = cell;
-  std::size_t sum_of_dimensions = 0;
-
-  for (std::size_t i = this->multipliers.size(); i != 0; --i) {
-    unsigned position = cell1 / this->multipliers[i - 1];
-    // this cell have a nonzero length in this direction, therefore we can compute its boundary in this direction.
-    if (position % 2 == 1) {
-      // if there are no periodic boundary conditions in this direction, we do not have to do anything.
-      if (!directions_in_which_periodic_b_cond_are_to_be_imposed[i - 1]) {
-        // std::cerr << "A\n";
-        if (sum_of_dimensions % 2) {
-          boundary_elements.push_back(cell - this->multipliers[i - 1]);
-          boundary_elements.push_back(cell + this->multipliers[i - 1]);
-        } else {
-          boundary_elements.push_back(cell + this->multipliers[i - 1]);
-          boundary_elements.push_back(cell - this->multipliers[i - 1]);
-        }
-        if (dbg) {
-          std::cerr << cell - this->multipliers[i - 1] << " " << cell + this->multipliers[i - 1] << " ";
-        }
-      } else {
-        // in this direction we have to do boundary conditions. Therefore, we need to check if we are not at the end.
-        if (position != 2 * this->sizes[i - 1] - 1) {
-          // std::cerr << "B\n";
-          if (sum_of_dimensions % 2) {
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
-            boundary_elements.push_back(cell + this->multipliers[i - 1]);
-          } else {
-            boundary_elements.push_back(cell + this->multipliers[i - 1]);
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
-          }
-          if (dbg) {
-            std::cerr << cell - this->multipliers[i - 1] << " " << cell + this->multipliers[i - 1] << " ";
-          }
-        } else {
-          // std::cerr << "C\n";
-          if (sum_of_dimensions % 2) {
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
-            boundary_elements.push_back(cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
-          } else {
-            boundary_elements.push_back(cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
-          }
-          if (dbg) {
-            std::cerr << cell - this->multipliers[i - 1] << " "
-                      << cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1] << " ";
-          }
-        }
-      }
-      ++sum_of_dimensions;
-    }
-    cell1 = cell1 % this->multipliers[i - 1];
-  }
+  for (std::size_t element : boundary) boundary_elements.push_back(element);
   return boundary_elements;
 }
 
 template <typename T>
 std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::get_coboundary_of_a_cell(
     std::size_t cell) const {
-  std::vector<unsigned> counter = this->compute_counter_for_given_cell(cell);
+  Coboundary_range coboundary = this->coboundary_range(cell);
   std::vector<std::size_t> coboundary_elements;
-  std::size_t cell1 = cell;
-  for (std::size_t i = this->multipliers.size(); i != 0; --i) {
-    unsigned position = cell1 / this->multipliers[i - 1];
-    // if the cell has zero length in this direction, then it will have cbd in this direction.
-    if (position % 2 == 0) {
-      if (!this->directions_in_which_periodic_b_cond_are_to_be_imposed[i - 1]) {
-        // no periodic boundary conditions in this direction
-        if ((counter[i - 1] != 0) && (cell > this->multipliers[i - 1])) {
-          coboundary_elements.push_back(cell - this->multipliers[i - 1]);
-        }
-        if ((counter[i - 1] != 2 * this->sizes[i - 1]) && (cell + this->multipliers[i - 1] < this->data.size())) {
-          coboundary_elements.push_back(cell + this->multipliers[i - 1]);
-        }
-      } else {
-        // we want to have periodic boundary conditions in this direction
-        if (counter[i - 1] != 0) {
-          coboundary_elements.push_back(cell - this->multipliers[i - 1]);
-          coboundary_elements.push_back(cell + this->multipliers[i - 1]);
-        } else {
-          // in this case counter[i-1] == 0.
-          coboundary_elements.push_back(cell + this->multipliers[i - 1]);
-          coboundary_elements.push_back(cell + (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
-        }
-      }
-    }
-
-    cell1 = cell1 % this->multipliers[i - 1];
-  }
+  coboundary_elements.reserve(this->dimension() * 2);
+  for (std::size_t element : coboundary) coboundary_elements.push_back(element);
   return coboundary_elements;
 }
 
@@ -0,0 +1,299 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef BITMAP_CUBICAL_COMPLEX_PERSISTENCE_H_
+#define BITMAP_CUBICAL_COMPLEX_PERSISTENCE_H_
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <vector>
+#include <utility>  // for std::pair, std::swap
+#include <algorithm>  // for std::sort, std::set_symmetric_difference, std::min, std::make_heap
+#include <functional>  // for std::greater
+#include <iterator>  // for std::back_inserter
+#include <limits>  // for std::numeric_limits
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint32_t
+
+namespace Gudhi {
+
+namespace cubical_complex {
+
+/** \private
+ * \brief Computes the persistence diagrams of a bitmap cubical complex, see `compute_persistence_diagrams()`.
+ *
+ * The cells of each dimension are sorted by filtration value, then by position in the bitmap, which is the order of
+ * `Bitmap_cubical_complex` restricted to one dimension. The pairs of dimension 0 are computed with a union-find on
+ * the vertices, the pairs of the top dimension with a union-find on the top dimensional cells, processed in the
+ * reverse order and where the cells that are on the boundary of the bitmap are adjacent to an extra cell "outside".
+ * Only the boundaries of the cells of the intermediate dimensions are reduced, by decreasing dimension, so that the
+ * cells that were paired in the previous dimension are skipped (clearing), and without the faces that are already
+ * known to be the death of an interval (compression).
+ *
+ * Index is the type of the positions of the cells in the bitmap and of their ranks, it must be able to represent the
+ * number of cells of the bitmap.
+ */
+template <class Bitmap, typename Index = std::size_t>
+class Bitmap_cubical_complex_persistence {
+ public:
+  typedef typename Bitmap::filtration_type Filtration_value;
+  typedef std::pair<Filtration_value, Filtration_value> Persistence_interval;
+
+  /* The cells of a dimension are sorted by chunks of sort_chunk_size cells, that are then merged. */
+  explicit Bitmap_cubical_complex_persistence(const Bitmap& bitmap,
+                                              std::size_t sort_chunk_size = std::size_t(1) << 20)
+      : bitmap_(bitmap),
+        dimension_(bitmap.dimension()),
+        sort_chunk_size_(sort_chunk_size),
+        cells_(dimension_ + 1),
+        rank_(bitmap.size()),
+        paired_(bitmap.size(), false),
+        diagrams_(dimension_ + 1) {}
+
+  std::vector<std::vector<Persistence_interval>> compute(Filtration_value min_interval_length) {
+    min_interval_length_ = min_interval_length;
+    sort_cells();
+    pair_vertices();
+    if (dimension_ > 1) pair_top_dimensional_cells();
+    if (dimension_ > 2)
+      for (std::size_t dim = dimension_ - 1; dim >= 2; --dim) reduce_boundaries(dim);
+    // The cells that are not paired are the birth of an essential class.
+    for (std::size_t dim = 0; dim <= dimension_; ++dim)
+      for (std::size_t cell : cells_[dim])
+        if (!paired_[cell])
+          add_interval(dim, bitmap_.get_cell_data(cell), std::numeric_limits<Filtration_value>::infinity());
+    return std::move(diagrams_);
+  }
+
+ private:
+  static const Index null_index = std::numeric_limits<Index>::max();
+
+  void sort_cells() {
+    // The dimension of each cell is computed once, and kept in its rank until the cells are sorted.
+    std::vector<std::size_t> counts(dimension_ + 1, 0);
+    for (std::size_t cell = 0; cell != bitmap_.size(); ++cell) {
+      rank_[cell] = bitmap_.get_dimension_of_a_cell(cell);
+      ++counts[rank_[cell]];
+    }
+    for (std::size_t dim = 0; dim <= dimension_; ++dim) cells_[dim].reserve(counts[dim]);
+    for (std::size_t cell = 0; cell != bitmap_.size(); ++cell) cells_[rank_[cell]].push_back(cell);
+    for (std::size_t dim = 0; dim <= dimension_; ++dim) {
+      sort_by_filtration(cells_[dim]);
+      for (std::size_t i = 0; i != cells_[dim].size(); ++i) rank_[cells_[dim][i]] = i;
+    }
+  }
+
+  // Sorts cells, given by increasing position, by filtration value then position. The (filtration value, position)
+  // keys are only built for a chunk of cells at a time, so that the sort does not access the bitmap, and the sorted
+  // chunks are merged with the key of the first cell left in each chunk.
+  void sort_by_filtration(std::vector<Index>& cells) {
+    typedef std::pair<Filtration_value, Index> Key;
+    std::vector<Key> keys;
+    keys.reserve((std::min)(cells.size(), sort_chunk_size_));
+    for (std::size_t first = 0; first < cells.size(); first += sort_chunk_size_) {
+      std::size_t last = (std::min)(first + sort_chunk_size_, cells.size());
+      keys.clear();
+      for (std::size_t i = first; i != last; ++i) keys.emplace_back(bitmap_.get_cell_data(cells[i]), cells[i]);
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_sort(keys.begin(), keys.end());
+#else
+      std::sort(keys.begin(), keys.end());
+#endif
+      for (std::size_t i = first; i != last; ++i) cells[i] = keys[i - first].second;
+    }
+    if (cells.size() <= sort_chunk_size_) return;
+    keys = std::vector<Key>();
+
+    // Min-heap of the first cell left in each chunk, with the index of the chunk.
+    typedef std::pair<Key, std::size_t> Head;
+    std::vector<Head> heads;
+    std::vector<std::size_t> next;
+    for (std::size_t first = 0; first < cells.size(); first += sort_chunk_size_) {
+      heads.emplace_back(Key(bitmap_.get_cell_data(cells[first]), cells[first]), next.size());
+      next.push_back(first);
+    }
+    std::greater<Head> later;
+    std::make_heap(heads.begin(), heads.end(), later);
+    std::vector<Index> merged;
+    merged.reserve(cells.size());
+    while (!heads.empty()) {
+      std::pop_heap(heads.begin(), heads.end(), later);
+      Head& head = heads.back();
+      merged.push_back(head.first.second);
+      std::size_t chunk = head.second;
+      std::size_t cell = ++next[chunk];
+      if (cell != (std::min)((chunk + 1) * sort_chunk_size_, cells.size())) {
+        head.first = Key(bitmap_.get_cell_data(cells[cell]), cells[cell]);
+        std::push_heap(heads.begin(), heads.end(), later);
+      } else {
+        heads.pop_back();
+      }
+    }
+    cells.swap(merged);
+  }
+
+  void add_interval(std::size_t dim, Filtration_value birth, Filtration_value death) {
+    if (death - birth > min_interval_length_) diagrams_[dim].emplace_back(birth, death);
+  }
+
+  static Index find(std::vector<Index>& parent, Index node) {
+    while (parent[node] != node) {
+      // path halving
+      parent[node] = parent[parent[node]];
+      node = parent[node];
+    }
+    return node;
+  }
+
+  // Kruskal on the edges: an edge that joins two components kills the youngest one.
+  void pair_vertices() {
+    const std::vector<Index>& vertices = cells_[0];
+    std::vector<Index> parent(vertices.size());
+    for (std::size_t i = 0; i != parent.size(); ++i) parent[i] = i;
+    if (dimension_ == 0) return;
+    for (std::size_t edge : cells_[1]) {
+      auto boundary = bitmap_.boundary_range(edge);
+      auto it = boundary.begin();
+      Index root1 = find(parent, rank_[*it]);
+      Index root2 = find(parent, rank_[*++it]);
+      if (root1 == root2) continue;
+      if (root1 < root2) std::swap(root1, root2);
+      // root1 is the youngest component
+      parent[root1] = root2;
+      paired_[vertices[root1]] = true;
+      paired_[edge] = true;
+      add_interval(0, bitmap_.get_cell_data(vertices[root1]), bitmap_.get_cell_data(edge));
+    }
+  }
+
+  // Dual of pair_vertices: the cells of codimension 1, in decreasing order, join the top dimensional cells of their
+  // coboundary, and when two components meet, the one whose oldest cell comes first in the filtration dies.
+  void pair_top_dimensional_cells() {
+    const std::vector<Index>& top_cells = cells_[dimension_];
+    const std::vector<Index>& facets = cells_[dimension_ - 1];
+    // The cell outside of the bitmap is the last one in the filtration.
+    const Index outside = top_cells.size();
+    std::vector<Index> parent(top_cells.size() + 1);
+    for (std::size_t i = 0; i != parent.size(); ++i) parent[i] = i;
+    for (auto facet_it = facets.rbegin(); facet_it != facets.rend(); ++facet_it) {
+      std::size_t facet = *facet_it;
+      Index nodes[2] = {outside, outside};
+      unsigned num_nodes = 0;
+      for (std::size_t coface : bitmap_.coboundary_range(facet)) nodes[num_nodes++] = rank_[coface];
+      Index root1 = find(parent, nodes[0]);
+      Index root2 = find(parent, nodes[1]);
+      if (root1 == root2) continue;
+      if (root1 > root2) std::swap(root1, root2);
+      // root1 is the youngest component in the reverse order
+      parent[root1] = root2;
+      paired_[top_cells[root1]] = true;
+      paired_[facet] = true;
+      add_interval(dimension_ - 1, bitmap_.get_cell_data(facet), bitmap_.get_cell_data(top_cells[root1]));
+    }
+  }
+
+  // Standard reduction of the boundaries of the cells of dimension dim, stored as sorted ranks of their faces.
+  void reduce_boundaries(std::size_t dim) {
+    const std::vector<Index>& faces = cells_[dim - 1];
+    // The reduced boundaries that have a pivot are stored contiguously.
+    std::vector<Index> pivot_column(faces.size(), null_index);
+    std::vector<std::size_t> column_starts(1, 0);
+    std::vector<Index> column_entries;
+    std::vector<Index> column;
+    std::vector<Index> sum;
+    for (std::size_t cell : cells_[dim]) {
+      // clearing: this cell is already the birth of an interval of dimension dim.
+      if (paired_[cell]) continue;
+      column.clear();
+      for (std::size_t face : bitmap_.boundary_range(cell)) {
+        // compression: a face that is already paired, but not with a column of this dimension, is the death of an
+        // interval, and it is never the pivot of a column, so its row can be removed.
+        if (paired_[face] && pivot_column[rank_[face]] == null_index) continue;
+        column.push_back(rank_[face]);
+      }
+      std::sort(column.begin(), column.end());
+      // A face appears twice in the boundary along a periodic direction of size 1, and cancels in Z/2Z.
+      std::size_t column_size = 0;
+      for (std::size_t i = 0; i != column.size(); ++i) {
+        if (i + 1 != column.size() && column[i] == column[i + 1])
+          ++i;
+        else
+          column[column_size++] = column[i];
+      }
+      column.resize(column_size);
+      while (!column.empty()) {
+        Index other = pivot_column[column.back()];
+        if (other == null_index) break;
+        sum.clear();
+        std::set_symmetric_difference(column.begin(), column.end(), column_entries.begin() + column_starts[other],
+                                      column_entries.begin() + column_starts[other + 1], std::back_inserter(sum));
+        column.swap(sum);
+      }
+      if (column.empty()) continue;
+      Index pivot = column.back();
+      pivot_column[pivot] = column_starts.size() - 1;
+      column_entries.insert(column_entries.end(), column.begin(), column.end());
+      column_starts.push_back(column_entries.size());
+      paired_[faces[pivot]] = true;
+      paired_[cell] = true;
+      add_interval(dim - 1, bitmap_.get_cell_data(faces[pivot]), bitmap_.get_cell_data(cell));
+    }
+  }
+
+  const Bitmap& bitmap_;
+  std::size_t dimension_;
+  std::size_t sort_chunk_size_;
+  Filtration_value min_interval_length_;
+  // Cells of each dimension, in the order of the filtration.
+  std::vector<std::vector<Index>> cells_;
+  // Position of each cell in the cells of its dimension.
+  std::vector<Index> rank_;
+  std::vector<bool> paired_;
+  std::vector<std::vector<Persistence_interval>> diagrams_;
+};
+
+template <class Bitmap, typename Index>
+const Index Bitmap_cubical_complex_persistence<Bitmap, Index>::null_index;
+
+/** \brief Computes the persistence diagrams of a cubical complex, with coefficients in \f$\mathbb{Z}/2\mathbb{Z}\f$.
+ *
+ * \ingroup cubical_complex
+ *
+ * This is a faster alternative to `Gudhi::persistent_cohomology::Persistent_cohomology` for cubical complexes. It
+ * does not need the filtration of `Bitmap_cubical_complex`: the cells of each dimension are sorted separately, the
+ * pairs of dimension 0 and of the top dimension are computed with union-find data structures on the vertices and on
+ * the top dimensional cells, and only the boundaries of the cells of the other dimensions are reduced. Besides the
+ * bitmap and the reduced boundaries, it stores the position and the rank of each cell, on 32 bits when the bitmap has
+ * less than \f$2^{32}\f$ cells and on 64 bits otherwise.
+ *
+ * @param[in] bitmap A `Bitmap_cubical_complex_base`, a `Bitmap_cubical_complex_periodic_boundary_conditions_base`,
+ * or a `Bitmap_cubical_complex` built on one of them.
+ * @param[in] min_interval_length The intervals of length less or equal than min_interval_length are discarded.
+ * @return For each dimension from 0 to the dimension of the bitmap, the (birth, death) pairs of the persistence
+ * diagram, in no particular order. The death of the essential classes is \f$+\infty\f$.
+ */
+template <class Bitmap>
+std::vector<std::vector<std::pair<typename Bitmap::filtration_type, typename Bitmap::filtration_type>>>
+compute_persistence_diagrams(const Bitmap& bitmap, typename Bitmap::filtration_type min_interval_length = 0) {
+  // 32-bit positions and ranks when they fit, to halve the memory needed per cell.
+  if (bitmap.size() < std::numeric_limits<std::uint32_t>::max()) {
+    Bitmap_cubical_complex_persistence<Bitmap, std::uint32_t> persistence(bitmap);
+    return persistence.compute(min_interval_length);
+  }
+  Bitmap_cubical_complex_persistence<Bitmap, std::size_t> persistence(bitmap);
+  return persistence.compute(min_interval_length);
+}
+
+}  // namespace cubical_complex
+
+namespace Cubical_complex = cubical_complex;
+
+}  // namespace Gudhi
+
+#endif  // BITMAP_CUBICAL_COMPLEX_PERSISTENCE_H_
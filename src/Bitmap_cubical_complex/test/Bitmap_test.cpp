@@ -16,6 +16,7 @@
 
 #include <gudhi/reader_utils.h>
 #include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Bitmap_cubical_complex_persistence.h>
 #include <gudhi/Persistent_cohomology.h>
 
 // standard stuff
@@ -23,6 +24,9 @@
 #include <sstream>
 #include <vector>
 #include <limits>
+#include <random>
+#include <algorithm>
+#include <utility>
 
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex_base<double> Bitmap_cubical_complex_base;
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_base> Bitmap_cubical_complex;
@@ -1581,3 +1585,114 @@ BOOST_AUTO_TEST_CASE(perseus_file_read) {
   std::cout << "Second value of sinusoid.txt is " << value << std::endl;
   BOOST_CHECK(value == std::numeric_limits<double>::infinity());
 }
+
+template <typename Cubical_complex>
+void check_persistence_diagrams(Cubical_complex& cmplx) {
+  typedef Gudhi::persistent_cohomology::Persistent_cohomology<Cubical_complex, Gudhi::persistent_cohomology::Field_Zp>
+      Persistent_cohomology;
+  auto diagrams = Gudhi::cubical_complex::compute_persistence_diagrams(cmplx);
+  BOOST_CHECK(diagrams.size() == cmplx.dimension() + 1);
+
+  Persistent_cohomology pcoh(cmplx, true);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology(0);
+  for (std::size_t dim = 0; dim != diagrams.size(); ++dim) {
+    std::vector<std::pair<double, double>> expected = pcoh.intervals_in_dimension(dim);
+    std::sort(expected.begin(), expected.end());
+    std::sort(diagrams[dim].begin(), diagrams[dim].end());
+    std::cout << "Dimension " << dim << " : " << diagrams[dim].size() << " intervals" << std::endl;
+    BOOST_CHECK(diagrams[dim] == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(compute_persistence_diagrams_as_persistent_cohomology) {
+  std::mt19937 gen(7);
+  // integer values, to have many cells with the same filtration value
+  std::uniform_int_distribution<int> dist(0, 5);
+  std::vector<std::vector<unsigned>> all_sizes = {{10}, {6, 5}, {4, 5, 3}, {3, 2, 3, 2}, {1, 1, 3}};
+  for (const std::vector<unsigned>& sizes : all_sizes) {
+    std::size_t number_of_top_cells = 1;
+    for (unsigned size : sizes) number_of_top_cells *= size;
+    std::vector<double> data(number_of_top_cells);
+    for (double& value : data) value = dist(gen);
+
+    Bitmap_cubical_complex cmplx(sizes, data);
+    check_persistence_diagrams(cmplx);
+
+    // all the combinations of periodic directions
+    for (unsigned mask = 1; mask != (1u << sizes.size()); ++mask) {
+      std::vector<bool> periodic_directions;
+      for (std::size_t i = 0; i != sizes.size(); ++i) periodic_directions.push_back((mask >> i) & 1);
+      Bitmap_cubical_complex_periodic_boundary_conditions periodic_cmplx(sizes, data, periodic_directions);
+      check_persistence_diagrams(periodic_cmplx);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(compute_persistence_diagrams_sorted_by_chunks) {
+  typedef Gudhi::cubical_complex::Bitmap_cubical_complex_base<double> Bitmap;
+  Bitmap bitmap("sinusoid.txt");
+  auto diagrams = Gudhi::cubical_complex::compute_persistence_diagrams(bitmap);
+  // chunks of 7 keys, merged afterwards, and 64 bit positions and ranks
+  Gudhi::cubical_complex::Bitmap_cubical_complex_persistence<Bitmap, std::size_t> persistence(bitmap, 7);
+  auto chunked_diagrams = persistence.compute(0.);
+  BOOST_CHECK(chunked_diagrams.size() == diagrams.size());
+  for (std::size_t dim = 0; dim != diagrams.size(); ++dim) {
+    std::sort(diagrams[dim].begin(), diagrams[dim].end());
+    std::sort(chunked_diagrams[dim].begin(), chunked_diagrams[dim].end());
+    BOOST_CHECK(chunked_diagrams[dim] == diagrams[dim]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(compute_persistence_diagrams_min_interval_length) {
+  Bitmap_cubical_complex cmplx("sinusoid.txt");
+  auto all_diagrams = Gudhi::cubical_complex::compute_persistence_diagrams(cmplx);
+  auto diagrams = Gudhi::cubical_complex::compute_persistence_diagrams(cmplx, 5.);
+  for (std::size_t dim = 0; dim != diagrams.size(); ++dim) {
+    std::size_t number_of_long_intervals = 0;
+    for (auto interval : all_diagrams[dim]) {
+      if (interval.second - interval.first > 5.) ++number_of_long_intervals;
+    }
+    BOOST_CHECK(diagrams[dim].size() == number_of_long_intervals);
+    for (auto interval : diagrams[dim]) {
+      BOOST_CHECK(std::find(all_diagrams[dim].begin(), all_diagrams[dim].end(), interval) != all_diagrams[dim].end());
+    }
+  }
+}
+
+// The minimum of the values of the cells that contain the cell, computed with the coboundaries.
+template <typename Bitmap>
+double min_over_star(const Bitmap& bitmap, const std::vector<double>& values, std::size_t cell) {
+  double value = values[cell];
+  for (std::size_t coface : bitmap.get_coboundary_of_a_cell(cell))
+    value = std::min(value, min_over_star(bitmap, values, coface));
+  return value;
+}
+
+template <typename Bitmap>
+void check_impose_lower_star_filtration(Bitmap& bitmap, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(0., 1.);
+  std::vector<double> values(bitmap.size());
+  for (std::size_t cell = 0; cell != bitmap.size(); ++cell) bitmap.get_cell_data(cell) = values[cell] = dist(gen);
+  bitmap.impose_lower_star_filtration();
+  for (std::size_t cell = 0; cell != bitmap.size(); ++cell)
+    BOOST_CHECK(bitmap.get_cell_data(cell) == min_over_star(bitmap, values, cell));
+}
+
+BOOST_AUTO_TEST_CASE(impose_lower_star_filtration_is_min_over_star) {
+  std::mt19937 gen(13);
+  std::vector<std::vector<unsigned>> all_sizes = {{7}, {4, 3}, {3, 2, 4}, {2, 1, 2, 3}, {1, 1, 2}};
+  for (const std::vector<unsigned>& sizes : all_sizes) {
+    Bitmap_cubical_complex_base bitmap(sizes);
+    check_impose_lower_star_filtration(bitmap, gen);
+    for (unsigned mask = 1; mask != (1u << sizes.size()); ++mask) {
+      std::vector<bool> periodic_directions;
+      for (std::size_t i = 0; i != sizes.size(); ++i) periodic_directions.push_back((mask >> i) & 1);
+      std::size_t number_of_top_cells = 1;
+      for (unsigned size : sizes) number_of_top_cells *= size;
+      Bitmap_cubical_complex_periodic_boundary_conditions_base periodic_bitmap(
+          sizes, std::vector<double>(number_of_top_cells, 0.), periodic_directions);
+      check_impose_lower_star_filtration(periodic_bitmap, gen);
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Bitmap_cubical_complex_periodic_boundary_conditions_base.h>
+#include <gudhi/Bitmap_cubical_complex_persistence.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>  // for std::sort
+#include <utility>  // for std::pair
+#include <limits>
+#include <cstddef>
+
+int main(int argc, char** argv) {
+  std::cout << "This program computes persistent homology with Z/2Z coefficients, by using the dedicated engine "
+            << "compute_persistence_diagrams, of cubical complexes provided in text files in Perseus style (see "
+            << "cubical_complex_persistence). A negative number of top dimensional cells in a direction means "
+            << "periodic boundary conditions in this direction.\n"
+            << std::endl;
+
+  if (argc != 2) {
+    std::cerr << "Wrong number of parameters. Please provide the name of a file with a Perseus style bitmap at "
+              << "the input. The program will now terminate.\n";
+    return 1;
+  }
+
+  // Without negative sizes in the file, there are no periodic boundary conditions.
+  typedef Gudhi::cubical_complex::Bitmap_cubical_complex_periodic_boundary_conditions_base<double> Bitmap;
+  typedef std::pair<double, double> Interval;
+
+  Bitmap b(argv[1]);
+  std::vector<std::vector<Interval>> diagrams = Gudhi::cubical_complex::compute_persistence_diagrams(b);
+
+  std::string output_file_name(argv[1]);
+  output_file_name += "_persistence";
+
+  std::size_t last_in_path = output_file_name.find_last_of("/\\");
+
+  if (last_in_path != std::string::npos) {
+    output_file_name = output_file_name.substr(last_in_path + 1);
+  }
+
+  // Same format as Persistent_cohomology::output_diagram, intervals sorted by decreasing length.
+  std::vector<std::pair<std::size_t, Interval>> intervals;
+  for (std::size_t dim = 0; dim != diagrams.size(); ++dim)
+    for (const Interval& interval : diagrams[dim]) intervals.emplace_back(dim, interval);
+  std::stable_sort(intervals.begin(), intervals.end(),
+                   [](const std::pair<std::size_t, Interval>& i1, const std::pair<std::size_t, Interval>& i2) {
+                     return i1.second.second - i1.second.first > i2.second.second - i2.second.first;
+                   });
+
+  std::ofstream out(output_file_name.c_str());
+  for (const auto& interval : intervals) {
+    out << 2 << "  " << interval.first << " " << interval.second.first << " ";
+    if (interval.second.second == std::numeric_limits<double>::infinity())
+      out << "inf " << std::endl;
+    else
+      out << interval.second.second << " " << std::endl;
+  }
+  out.close();
+
+  std::cout << "Result in file: " << output_file_name << "\n";
+
+  return 0;
+}
@@ -19,6 +19,7 @@ using namespace Gudhi::persistence_diagram;
 
 
 double upper_bound = 400.;  // any real > 0
+int max_n_sorted_distances = 4000;  // the exact algorithm with all the distances needs almost 1GB for n = 4000
 
 int main() {
   std::ofstream result_file;
@@ -46,7 +47,23 @@ int main() {
     std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
     typedef std::chrono::duration<int, std::milli> millisecs_t;
     millisecs_t duration(std::chrono::duration_cast<millisecs_t>(end - start));
-    result_file << n << ";" << duration.count() << ";" << b << std::endl;
+    result_file << n << ";" << duration.count() << ";" << b;
+
+    // Exact distance, without and with the list of all the distances, which needs too much memory for large n
+    Persistence_graph g(v1, v2, 0.);
+    start = std::chrono::steady_clock::now();
+    b = bottleneck_distance_exact_low_memory(g);
+    end = std::chrono::steady_clock::now();
+    duration = std::chrono::duration_cast<millisecs_t>(end - start);
+    result_file << ";" << duration.count() << ";" << b;
+    if (n <= max_n_sorted_distances) {
+      start = std::chrono::steady_clock::now();
+      b = bottleneck_distance_exact(g);
+      end = std::chrono::steady_clock::now();
+      duration = std::chrono::duration_cast<millisecs_t>(end - start);
+      result_file << ";" << duration.count() << ";" << b;
+    }
+    result_file << std::endl;
   }
   result_file.close();
 }
@@ -0,0 +1,70 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+// Compares the data structures of the matchings: the CGAL kd-trees and hash tables, and the uniform grid and vectors.
+
+#include <gudhi/Bottleneck.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <limits>  // for numeric_limits
+
+using namespace Gudhi::persistence_diagram;
+
+double upper_bound = 400.;  // any real > 0
+
+typedef std::chrono::duration<int, std::milli> millisecs_t;
+
+template<typename GraphMatchingOptions>
+void chrono(std::ofstream& result_file, Persistence_graph& g_approx, Persistence_graph& g_exact) {
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  double b = bottleneck_distance_approx<GraphMatchingOptions>(g_approx, (std::numeric_limits<double>::min)());
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  millisecs_t duration(std::chrono::duration_cast<millisecs_t>(end - start));
+  result_file << ";" << duration.count() << ";" << b;
+
+  start = std::chrono::steady_clock::now();
+  b = bottleneck_distance_exact_low_memory<GraphMatchingOptions>(g_exact);
+  end = std::chrono::steady_clock::now();
+  duration = std::chrono::duration_cast<millisecs_t>(end - start);
+  result_file << ";" << duration.count() << ";" << b;
+}
+
+int main() {
+  std::ofstream result_file;
+  result_file.open("results_matching.csv", std::ios::out);
+  result_file << "n;kd-tree approx ms;distance;kd-tree exact ms;distance;grid approx ms;distance;grid exact ms;distance"
+              << std::endl;
+
+  for (int n = 1000; n <= 10000; n += 3000) {
+    std::uniform_real_distribution<double> unif1(0., upper_bound);
+    std::uniform_real_distribution<double> unif2(upper_bound / 1000., upper_bound / 100.);
+    std::default_random_engine re;
+    std::vector< std::pair<double, double> > v1, v2;
+    for (int i = 0; i < n; i++) {
+      double a = unif1(re);
+      double b = unif1(re);
+      double x = unif2(re);
+      double y = unif2(re);
+      v1.emplace_back(std::min(a, b), std::max(a, b));
+      v2.emplace_back(std::min(a, b) + std::min(x, y), std::max(a, b) + std::max(x, y));
+      if (i % 5 == 0)
+        v1.emplace_back(std::min(a, b), std::min(a, b) + x);
+      if (i % 3 == 0)
+        v2.emplace_back(std::max(a, b), std::max(a, b) + y);
+    }
+    Persistence_graph g_approx(v1, v2, (std::numeric_limits<double>::min)());
+    Persistence_graph g_exact(v1, v2, 0.);
+    result_file << n;
+    chrono<Graph_matching_kd_tree_options>(result_file, g_approx, g_exact);
+    chrono<Graph_matching_grid_options>(result_file, g_approx, g_exact);
+    result_file << std::endl;
+    std::cout << "n = " << n << " done" << std::endl;
+  }
+  result_file.close();
+}
@@ -0,0 +1,58 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Wasserstein.h>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::min, std::max
+
+using namespace Gudhi::persistence_diagram;
+
+
+double upper_bound = 400.;  // any real > 0
+int max_n_exact = 10000;  // the exact computation is much slower
+
+// Same diagrams as in bottleneck_chrono.cpp
+int main() {
+  std::ofstream result_file;
+  result_file.open("results_wasserstein.csv", std::ios::out);
+  result_file << "n;order;delta;ms;w" << std::endl;
+
+  for (int n : {1000, 3000, 10000, 30000, 100000}) {
+    std::uniform_real_distribution<double> unif1(0., upper_bound);
+    std::uniform_real_distribution<double> unif2(upper_bound / 1000., upper_bound / 100.);
+    std::default_random_engine re;
+    std::vector< std::pair<double, double> > v1, v2;
+    for (int i = 0; i < n; i++) {
+      double a = unif1(re);
+      double b = unif1(re);
+      double x = unif2(re);
+      double y = unif2(re);
+      v1.emplace_back(std::min(a, b), std::max(a, b));
+      v2.emplace_back(std::min(a, b) + std::min(x, y), std::max(a, b) + std::max(x, y));
+      if (i % 5 == 0)
+        v1.emplace_back(std::min(a, b), std::min(a, b) + x);
+      if (i % 3 == 0)
+        v2.emplace_back(std::max(a, b), std::max(a, b) + y);
+    }
+    for (double order : {1., 2.}) {
+      for (double delta : {0.1, 0.01, 0.}) {
+        if (delta == 0. && n > max_n_exact) continue;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        double w = wasserstein_distance(v1, v2, order, delta);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        typedef std::chrono::duration<int, std::milli> millisecs_t;
+        millisecs_t duration(std::chrono::duration_cast<millisecs_t>(end - start));
+        result_file << n << ";" << order << ";" << delta << ";" << duration.count() << ";" << w << std::endl;
+      }
+    }
+  }
+  result_file.close();
+}
@@ -63,6 +63,11 @@ int main() {
  *
  * \image html bottleneck_distance_example.png The point (0, 13) is at distance 6.5 from the diagonal and more specifically from the point (6.5, 6.5)
  *
+ * To compare many persistence diagrams, `bottleneck_distance_matrix()` and `condensed_bottleneck_distance_matrix()`
+ * compute the distances between all their pairs, and `bottleneck_distances()` the distances between one diagram and
+ * many others. Each diagram is then preprocessed only once, and the distances are computed in parallel if TBB is
+ * available.
+ *
  * \section bottleneckbasicexample Basic example
  *
  * This other example computes the bottleneck distance from 2 persistence diagrams:
@@ -72,6 +77,14 @@ int main() {
     Bottleneck distance = 0.75
     Approx bottleneck distance = 0.808176
  * \endcode
+ *
+ * \section wassersteindistance Wasserstein distance
+ *
+ * The Wasserstein distance of order p replaces the length of the longest edge of the matching with the p-th root of
+ * the sum of the p-th powers of the lengths of the edges. `wasserstein_distance()` computes it, up to a given relative
+ * error, with the auction algorithm of "Geometry Helps to Compare Persistence Diagrams"
+ * \cite Kerber:2017:GHC:3047249.3064175: the points of a diagram bid for the points of the other one, whose price is
+ * taken into account by a 2d-tree to find the best point for a bidder, with epsilon-scaling. It does not need CGAL.
 
  */
 /** @} */  // end defgroup bottleneck_distance
@@ -15,10 +15,12 @@
 #define BOTTLENECK_H_
 
 #include <gudhi/Graph_matching.h>
+#include <gudhi/Persistence_graph_distances.h>
 
 #include <vector>
 #include <algorithm>  // for max
 #include <limits>  // for numeric_limits
+#include <cstddef>  // for std::size_t
 
 #include <cmath>
 #include <cfloat>  // FLT_EVAL_METHOD
@@ -27,12 +29,14 @@ namespace Gudhi {
 
 namespace persistence_diagram {
 
-inline double bottleneck_distance_approx(Persistence_graph& g, double e) {
+/* GraphMatchingOptions selects the data structures of the matchings, see Graph_matching. */
+template<typename GraphMatchingOptions = Graph_matching_kd_tree_options>
+double bottleneck_distance_approx(Persistence_graph& g, double e) {
   double b_lower_bound = 0.;
   double b_upper_bound = g.diameter_bound();
   const double alpha = std::pow(g.size(), 1. / 5.);
-  Graph_matching m(g);
-  Graph_matching biggest_unperfect(g);
+  Graph_matching_t<GraphMatchingOptions> m(g);
+  Graph_matching_t<GraphMatchingOptions> biggest_unperfect(g);
   while (b_upper_bound - b_lower_bound > 2 * e) {
     double step = b_lower_bound + (b_upper_bound - b_lower_bound) / alpha;
 #if !defined FLT_EVAL_METHOD || FLT_EVAL_METHOD < 0 || FLT_EVAL_METHOD > 1
@@ -57,13 +61,86 @@ inline double bottleneck_distance_approx(Persistence_graph& g, double e) {
   return (b_lower_bound + b_upper_bound) / 2.;
 }
 
-inline double bottleneck_distance_exact(Persistence_graph& g) {
+template<typename GraphMatchingOptions = Graph_matching_kd_tree_options>
+double bottleneck_distance_exact(Persistence_graph& g) {
   std::vector<double> sd = g.sorted_distances();
   long lower_bound_i = 0;
   long upper_bound_i = sd.size() - 1;
   const double alpha = std::pow(g.size(), 1. / 5.);
-  Graph_matching m(g);
-  Graph_matching biggest_unperfect(g);
+  Graph_matching_t<GraphMatchingOptions> m(g);
+  Graph_matching_t<GraphMatchingOptions> biggest_unperfect(g);
+  while (lower_bound_i != upper_bound_i) {
+    long step = lower_bound_i + static_cast<long> ((upper_bound_i - lower_bound_i - 1) / alpha);
+    m.set_r(sd.at(step));
+    while (m.multi_augment()) {}  // compute a maximum matching (in the graph corresponding to the current r)
+    if (m.perfect()) {
+      m = biggest_unperfect;
+      upper_bound_i = step;
+    } else {
+      biggest_unperfect = m;
+      lower_bound_i = step + 1;
+    }
+  }
+  return sd.at(lower_bound_i);
+}
+
+/* Same result as bottleneck_distance_exact, without the list of all the distances. The distances are only counted,
+ * and the candidate for the next matching is selected by its rank with a bisection on the values, until there are few
+ * enough distances between the bounds to list them. Not used by bottleneck_distance until it is timed against
+ * bottleneck_distance_exact with the CGAL kd-tree. */
+template<typename GraphMatchingOptions = Graph_matching_kd_tree_options>
+double bottleneck_distance_exact_low_memory(Persistence_graph& g) {
+  if (g.size() == 0)
+    return 0.;
+  Persistence_graph_distances distances(g);
+  // The result d is such that lower < d <= upper, and the matching is perfect for upper.
+  double lower = -1.;
+  double upper = distances.upper_bound();
+  std::size_t count_lower = 0;
+  std::size_t count_upper = distances.count(upper);
+  const std::size_t max_listed = 4 * static_cast<std::size_t>(g.size());
+  const double alpha = std::pow(g.size(), 1. / 5.);
+  Graph_matching_t<GraphMatchingOptions> m(g);
+  Graph_matching_t<GraphMatchingOptions> biggest_unperfect(g);
+  while (count_upper > count_lower + max_listed) {
+    std::size_t rank = count_lower + static_cast<std::size_t>((count_upper - count_lower - 1) / alpha);
+    // Bisection for a value in (lower, upper) with about rank smaller distances.
+    double a = lower;
+    double b = upper;
+    while (true) {
+      double mid = a + (b - a) / 2.;
+      if (mid <= a || mid >= b)
+        break;
+      std::size_t count_mid = distances.count(mid);
+      if (count_mid > rank) {
+        b = mid;
+        if (count_mid <= rank + max_listed)
+          break;
+      } else {
+        a = mid;
+      }
+    }
+    double step = b < upper ? b : a;
+    if (step <= lower)
+      return upper;  // there is no distance strictly between lower and upper
+    m.set_r(step);
+    while (m.multi_augment()) {}  // compute a maximum matching (in the graph corresponding to the current r)
+    if (m.perfect()) {
+      m = biggest_unperfect;
+      upper = step;
+      count_upper = distances.count(upper);
+    } else {
+      biggest_unperfect = m;
+      lower = step;
+      count_lower = distances.count(lower);
+    }
+  }
+  std::vector<double> sd = distances.sorted_distances(lower, upper);
+  if (sd.empty())
+    return upper;
+  // Same search as bottleneck_distance_exact, on the distances between the bounds.
+  long lower_bound_i = 0;
+  long upper_bound_i = sd.size() - 1;
   while (lower_bound_i != upper_bound_i) {
     long step = lower_bound_i + static_cast<long> ((upper_bound_i - lower_bound_i - 1) / alpha);
     m.set_r(sd.at(step));
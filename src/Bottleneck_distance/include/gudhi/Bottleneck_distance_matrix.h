@@ -0,0 +1,166 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef BOTTLENECK_DISTANCE_MATRIX_H_
+#define BOTTLENECK_DISTANCE_MATRIX_H_
+
+#include <gudhi/Bottleneck.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <iterator>  // for std::begin, std::end
+#include <algorithm>  // for std::sort, std::upper_bound
+#include <limits>  // for numeric_limits
+#include <cmath>  // for std::fabs
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief A persistence diagram prepared once for many bottleneck distance computations with the same
+ * error bound e: the points of persistence larger than e, and the sorted births of the essential classes.
+ *
+ * \ingroup bottleneck_distance
+ */
+struct Preprocessed_diagram {
+  std::vector<std::pair<double, double>> finite_points;
+  std::vector<double> essential_births;
+};
+
+/** \internal \brief Keeps the points of the diagram that Persistence_graph keeps for this e. */
+template<typename Persistence_diagram>
+Preprocessed_diagram preprocess_diagram(const Persistence_diagram& diag, double e) {
+  Preprocessed_diagram result;
+  for (auto it = std::begin(diag); it != std::end(diag); ++it) {
+    if (std::get<1>(*it) == std::numeric_limits<double>::infinity())
+      result.essential_births.push_back(std::get<0>(*it));
+    else if (std::get<1>(*it) - std::get<0>(*it) > e)
+      result.finite_points.emplace_back(std::get<0>(*it), std::get<1>(*it));
+  }
+  std::sort(result.essential_births.begin(), result.essential_births.end());
+  return result;
+}
+
+/** \internal \brief Same as bottleneck_distance on the original diagrams, with the same e. */
+inline double bottleneck_distance(const Preprocessed_diagram& diag1, const Preprocessed_diagram& diag2, double e) {
+  // The distance between the essential classes is a lower bound, infinite if their numbers differ.
+  if (diag1.essential_births.size() != diag2.essential_births.size())
+    return std::numeric_limits<double>::infinity();
+  double b_alive = 0.;
+  for (std::size_t i = 0; i != diag1.essential_births.size(); ++i)
+    b_alive = (std::max)(b_alive, std::fabs(diag1.essential_births[i] - diag2.essential_births[i]));
+  Persistence_graph g(diag1.finite_points, diag2.finite_points, e);
+  return (std::max)(b_alive, e == 0. ? bottleneck_distance_exact(g) : bottleneck_distance_approx(g, e));
+}
+
+/** \brief Computes the Bottleneck distances between all the pairs of persistence diagrams, in the condensed form of
+ * a distance matrix: the distances between the i-th and the j-th diagram, for i < j, ordered by i then by j.
+ *
+ * Each diagram is preprocessed only once, and the distances are computed in parallel if TBB is available.
+ *
+ * \tparam Persistence_diagram A model of the concept `PersistenceDiagram`.
+ *
+ * \param[in] diagrams The persistence diagrams.
+ * \param[in] e The error bound, as in `bottleneck_distance()`.
+ * \return The vector of the \f$ n(n-1)/2 \f$ distances, where the distance between the diagrams i < j is at index
+ * \f$ n i - i (i + 1) / 2 + j - i - 1 \f$.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram>
+std::vector<double> condensed_bottleneck_distance_matrix(const std::vector<Persistence_diagram>& diagrams,
+                                                         double e = (std::numeric_limits<double>::min)()) {
+  std::vector<Preprocessed_diagram> preprocessed;
+  preprocessed.reserve(diagrams.size());
+  for (const Persistence_diagram& diag : diagrams)
+    preprocessed.push_back(preprocess_diagram(diag, e));
+
+  // row_starts[i] is the index of the distance between the diagrams i and i + 1.
+  std::vector<std::size_t> row_starts;
+  std::size_t number_of_distances = 0;
+  for (std::size_t i = 0; i + 1 < diagrams.size(); ++i) {
+    row_starts.push_back(number_of_distances);
+    number_of_distances += diagrams.size() - i - 1;
+  }
+  std::vector<double> distances(number_of_distances);
+  // One task per pair of diagrams, since their costs are very different.
+  auto compute_distance = [&](std::size_t index) {
+    std::size_t i = std::upper_bound(row_starts.begin(), row_starts.end(), index) - row_starts.begin() - 1;
+    std::size_t j = index - row_starts[i] + i + 1;
+    distances[index] = bottleneck_distance(preprocessed[i], preprocessed[j], e);
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(std::size_t(0), number_of_distances, compute_distance);
+#else
+  for (std::size_t index = 0; index < number_of_distances; ++index) compute_distance(index);
+#endif
+  return distances;
+}
+
+/** \brief Computes the Bottleneck distances between all the pairs of persistence diagrams, as a square matrix.
+ *
+ * Same as `condensed_bottleneck_distance_matrix()`, but the distance between the i-th and the j-th diagram is
+ * `matrix[i][j]`.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram>
+std::vector<std::vector<double>> bottleneck_distance_matrix(const std::vector<Persistence_diagram>& diagrams,
+                                                            double e = (std::numeric_limits<double>::min)()) {
+  std::vector<double> condensed = condensed_bottleneck_distance_matrix(diagrams, e);
+  std::vector<std::vector<double>> matrix(diagrams.size(), std::vector<double>(diagrams.size(), 0.));
+  std::size_t index = 0;
+  for (std::size_t i = 0; i < diagrams.size(); ++i) {
+    for (std::size_t j = i + 1; j < diagrams.size(); ++j) {
+      matrix[i][j] = condensed[index];
+      matrix[j][i] = condensed[index];
+      ++index;
+    }
+  }
+  return matrix;
+}
+
+/** \brief Computes the Bottleneck distances between one persistence diagram and each diagram of a list.
+ *
+ * The first diagram is preprocessed only once, and the distances are computed in parallel if TBB is available.
+ *
+ * \tparam Persistence_diagram1,Persistence_diagram2 Models of the concept `PersistenceDiagram`.
+ *
+ * \param[in] diag The persistence diagram.
+ * \param[in] diagrams The persistence diagrams to compare with diag.
+ * \param[in] e The error bound, as in `bottleneck_distance()`.
+ * \return The distances between diag and each diagram of diagrams, in the same order.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+std::vector<double> bottleneck_distances(const Persistence_diagram1& diag,
+                                         const std::vector<Persistence_diagram2>& diagrams,
+                                         double e = (std::numeric_limits<double>::min)()) {
+  Preprocessed_diagram preprocessed = preprocess_diagram(diag, e);
+  std::vector<double> distances(diagrams.size());
+  auto compute_distance = [&](std::size_t index) {
+    distances[index] = bottleneck_distance(preprocessed, preprocess_diagram(diagrams[index], e), e);
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(std::size_t(0), diagrams.size(), compute_distance);
+#else
+  for (std::size_t index = 0; index < diagrams.size(); ++index) compute_distance(index);
+#endif
+  return distances;
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // BOTTLENECK_DISTANCE_MATRIX_H_
@@ -14,23 +14,98 @@
 #define GRAPH_MATCHING_H_
 
 #include <gudhi/Neighbors_finder.h>
+#include <gudhi/Grid_neighbors_finder.h>
 
 #include <vector>
 #include <unordered_set>
 #include <algorithm>
+#include <cmath>  // for std::sqrt
+#include <cstddef>  // for std::size_t
 
 namespace Gudhi {
 
 namespace persistence_diagram {
 
+/** \internal \brief Set of point indices in [0, n), stored in a vector with the position of each point, so that
+ * insert and erase are O(1) without hashing. Same interface as the std::unordered_set<int> used by Graph_matching.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Dense_point_set {
+ public:
+  /** \internal \brief Constructor of an empty set of points in [0, n). */
+  explicit Dense_point_set(int n) : points(), position(n, -1) { points.reserve(n); }
+  void insert(int point_index) {
+    if (position[point_index] != -1) return;
+    position[point_index] = points.size();
+    points.push_back(point_index);
+  }
+  void erase(int point_index) {
+    if (position[point_index] == -1) return;
+    int last = points.back();
+    points[position[point_index]] = last;
+    position[last] = position[point_index];
+    position[point_index] = -1;
+    points.pop_back();
+  }
+  bool empty() const { return points.empty(); }
+  std::size_t size() const { return points.size(); }
+  std::vector<int>::const_iterator cbegin() const { return points.cbegin(); }
+  std::vector<int>::const_iterator cend() const { return points.cend(); }
+
+ private:
+  std::vector<int> points;
+  std::vector<int> position;
+};
+
+/** \internal \brief Options of Graph_matching_t with the original data structures: a CGAL kd-tree per layer to find
+ * the neighbors, and a hash table for the unmatched points. They are the ones of Graph_matching.
+ *
+ * \ingroup bottleneck_distance
+ */
+struct Graph_matching_kd_tree_options {
+  typedef Neighbors_finder Finder;
+  typedef Layered_neighbors_finder Layered_finder;
+  typedef std::unordered_set<int> Point_set;
+  /** \internal \brief What the finders need to know for the near distance r, only r here. */
+  typedef double Search_structure;
+  static Search_structure search_structure(const Persistence_graph&, double r, const Search_structure&) {
+    return r;
+  }
+};
+
+/** \internal \brief Options of Graph_matching_t with a uniform grid, reused for several r, to find the neighbors, and
+ * vectors for the unmatched points. benchmark/bottleneck_matching_chrono.cpp compares it with the kd-trees. It is not
+ * the default, as it has not been timed against the CGAL kd-trees yet.
+ *
+ * \ingroup bottleneck_distance
+ */
+struct Graph_matching_grid_options {
+  typedef Grid_neighbors_finder Finder;
+  typedef Layered_grid_neighbors_finder Layered_finder;
+  typedef Dense_point_set Point_set;
+  typedef Neighbors_grid Search_structure;
+  static Search_structure search_structure(const Persistence_graph& g, double r, const Search_structure& previous) {
+    return Neighbors_grid(g, r, previous);
+  }
+};
+
 /** \internal \brief Structure representing a graph matching. The graph is a Persistence_diagrams_graph.
+ *
+ * \tparam GraphMatchingOptions The data structures used to find the neighbors and to store the unmatched points,
+ * Graph_matching_grid_options or Graph_matching_kd_tree_options.
  *
  * \ingroup bottleneck_distance
  */
-class Graph_matching {
+template<typename GraphMatchingOptions>
+class Graph_matching_t {
+  typedef typename GraphMatchingOptions::Finder Finder;
+  typedef typename GraphMatchingOptions::Layered_finder Layered_finder;
+  typedef typename GraphMatchingOptions::Search_structure Search_structure;
+
  public:
   /** \internal \brief Constructor constructing an empty matching. */
-  explicit Graph_matching(Persistence_graph &g);
+  explicit Graph_matching_t(Persistence_graph &g);
   /** \internal \brief Is the matching perfect ? */
   bool perfect() const;
   /** \internal \brief Augments the matching with a maximal set of edge-disjoint shortest augmenting paths. */
@@ -41,35 +116,46 @@ class Graph_matching {
  private:
   Persistence_graph* gp;
   double r;
+  Search_structure search_structure;
   /** \internal \brief Given a point from V, provides its matched point in U, null_point_index() if there isn't. */
   std::vector<int> v_to_u;
   /** \internal \brief All the unmatched points in U. */
-  std::unordered_set<int> unmatched_in_u;
+  typename GraphMatchingOptions::Point_set unmatched_in_u;
 
-  /** \internal \brief Provides a Layered_neighbors_finder dividing the graph in layers. Basically a BFS. */
-  Layered_neighbors_finder layering() const;
+  /** \internal \brief Provides a Layered_finder dividing the graph in layers. Basically a BFS. */
+  Layered_finder layering() const;
   /** \internal \brief Augments the matching with a simple path no longer than max_depth. Basically a DFS. */
-  bool augment(Layered_neighbors_finder & layered_nf, int u_start_index, int max_depth);
+  bool augment(Layered_finder & layered_nf, int u_start_index, int max_depth);
   /** \internal \brief Update the matching with the simple augmenting path given as parameter. */
   void update(std::vector<int> & path);
 };
 
-inline Graph_matching::Graph_matching(Persistence_graph& g)
-    : gp(&g), r(0.), v_to_u(g.size(), null_point_index()), unmatched_in_u(g.size()) {
+/** \internal \brief Graph matching with the kd-trees, the default data structures.
+ *
+ * \ingroup bottleneck_distance
+ */
+typedef Graph_matching_t<Graph_matching_kd_tree_options> Graph_matching;
+
+template<typename GraphMatchingOptions>
+Graph_matching_t<GraphMatchingOptions>::Graph_matching_t(Persistence_graph& g)
+    : gp(&g), r(0.), search_structure(GraphMatchingOptions::search_structure(g, 0., Search_structure())),
+      v_to_u(g.size(), null_point_index()), unmatched_in_u(g.size()) {
   for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
     unmatched_in_u.insert(u_point_index);
 }
 
-inline bool Graph_matching::perfect() const {
+template<typename GraphMatchingOptions>
+bool Graph_matching_t<GraphMatchingOptions>::perfect() const {
   return unmatched_in_u.empty();
 }
 
-inline bool Graph_matching::multi_augment() {
+template<typename GraphMatchingOptions>
+bool Graph_matching_t<GraphMatchingOptions>::multi_augment() {
   if (perfect())
     return false;
-  Layered_neighbors_finder layered_nf(layering());
+  Layered_finder layered_nf(layering());
   int max_depth = layered_nf.vlayers_number()*2 - 1;
-  double rn = sqrt(gp->size());
+  double rn = std::sqrt(gp->size());
   // verification of a necessary criterion in order to shortcut if possible
   if (max_depth < 0 || (unmatched_in_u.size() > rn && max_depth >= rn))
     return false;
@@ -81,11 +167,14 @@ inline bool Graph_matching::multi_augment() {
   return successful;
 }
 
-inline void Graph_matching::set_r(double r) {
+template<typename GraphMatchingOptions>
+void Graph_matching_t<GraphMatchingOptions>::set_r(double r) {
   this->r = r;
+  search_structure = GraphMatchingOptions::search_structure(*gp, r, search_structure);
 }
 
-inline bool Graph_matching::augment(Layered_neighbors_finder & layered_nf, int u_start_index, int max_depth) {
+template<typename GraphMatchingOptions>
+bool Graph_matching_t<GraphMatchingOptions>::augment(Layered_finder & layered_nf, int u_start_index, int max_depth) {
   // V vertices have at most one successor, thus when we backtrack from U we can directly pop_back 2 vertices.
   std::vector<int> path;
   path.emplace_back(u_start_index);
@@ -113,13 +202,15 @@ inline bool Graph_matching::augment(Layered_neighbors_finder & layered_nf, int u
   return true;
 }
 
-inline Layered_neighbors_finder Graph_matching::layering() const {
+template<typename GraphMatchingOptions>
+typename Graph_matching_t<GraphMatchingOptions>::Layered_finder
+Graph_matching_t<GraphMatchingOptions>::layering() const {
   std::vector<int> u_vertices(unmatched_in_u.cbegin(), unmatched_in_u.cend());
   std::vector<int> v_vertices;
-  Neighbors_finder nf(*gp, r);
+  Finder nf(*gp, search_structure);
   for (int v_point_index = 0; v_point_index < gp->size(); ++v_point_index)
     nf.add(v_point_index);
-  Layered_neighbors_finder layered_nf(*gp, r);
+  Layered_finder layered_nf(*gp, search_structure);
   for (int layer = 0; !u_vertices.empty(); layer++) {
     // one layer is one step in the BFS
     for (auto it1 = u_vertices.cbegin(); it1 != u_vertices.cend(); ++it1) {
@@ -146,7 +237,8 @@ inline Layered_neighbors_finder Graph_matching::layering() const {
   return layered_nf;
 }
 
-inline void Graph_matching::update(std::vector<int>& path) {
+template<typename GraphMatchingOptions>
+void Graph_matching_t<GraphMatchingOptions>::update(std::vector<int>& path) {
   // Must return 1.
   unmatched_in_u.erase(path.front());
   for (auto it = path.cbegin(); it != path.cend(); ++it) {
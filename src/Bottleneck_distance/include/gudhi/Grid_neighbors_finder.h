@@ -0,0 +1,365 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef GRID_NEIGHBORS_FINDER_H_
+#define GRID_NEIGHBORS_FINDER_H_
+
+#include <gudhi/Persistence_graph.h>
+#include <gudhi/Internal_point.h>
+
+#include <vector>
+#include <memory>  // for std::shared_ptr
+#include <algorithm>  // for std::sort, std::unique, std::lower_bound, std::min, std::max
+#include <utility>  // for std::swap
+#include <cmath>  // for std::floor, std::ldexp
+#include <cstdint>  // for std::uint64_t, std::int64_t
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief Uniform grid on the points of V that are not projections, used to find their points near to a
+ * point of U.
+ *
+ * The cells are squares of side at least r, so the points of V near to a point of U are in the 3x3 cells around it.
+ * Only the non empty cells are stored, and the cells around each point of U are listed once, when the grid is built.
+ * The cells are shared by the copies of the grid, and are reused for another r when their size still suits it.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Neighbors_grid {
+ public:
+  /** \internal \brief Constructor of a grid without cells, to be replaced before any search. */
+  Neighbors_grid();
+  /** \internal \brief Constructor taking the near distance definition as parameter. It reuses the cells of previous,
+   * a grid on the same graph, if their size is between r and twice r. */
+  Neighbors_grid(const Persistence_graph& g, double r, const Neighbors_grid& previous);
+  /** \internal \brief Returns the near distance. */
+  double r() const;
+  /** \internal \brief Returns the cell of a point of V that is not a projection. */
+  int v_cell(int v_point_index) const;
+  /** \internal \brief The non empty cells around a point of U are [u_cells_begin, u_cells_end), sorted. */
+  const int* u_cells_begin(int u_point_index) const;
+  const int* u_cells_end(int u_point_index) const;
+
+ private:
+  struct Cells {
+    double cell_size;
+    // The smallest cell size, so that the indices of the cells fit in 32 bits.
+    double min_cell_size;
+    std::vector<int> v_cell;
+    // The cells around the point u of U are u_cells[u_cells_start[u], u_cells_start[u + 1]).
+    std::vector<int> u_cells_start;
+    std::vector<int> u_cells;
+  };
+
+  static std::shared_ptr<const Cells> build_cells(const Persistence_graph& g, double cell_size);
+
+  double radius;
+  std::shared_ptr<const Cells> cells;
+};
+
+/** \internal \brief data structure used to find any point (including projections) in V near to a query point from U
+ * (which can be a projection) in a layered graph layer given as parameter. Same as Layered_neighbors_finder, with a
+ * Neighbors_grid instead of a kd-tree per layer.
+ *
+ * V points have to be added manually using their index and before the first pull. A neighbor pulled is automatically
+ * removed.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Layered_grid_neighbors_finder {
+ public:
+  /** \internal \brief Constructor taking the grid of the near distance as parameter. */
+  Layered_grid_neighbors_finder(const Persistence_graph& g, const Neighbors_grid& grid);
+  /** \internal \brief A point added will be possibly pulled. */
+  void add(int v_point_index, int vlayer);
+  /** \internal \brief Returns and remove a V point near to the U point given as parameter, null_point_index() if
+   * there isn't such a point. */
+  int pull_near(int u_point_index, int vlayer);
+  /** \internal \brief Returns and remove all the V points near to the U point given as parameter. */
+  std::vector<int> pull_all_near(int u_point_index, int vlayer);
+  /** \internal \brief Returns the number of layers. */
+  int vlayers_number() const;
+
+ private:
+  struct Layer {
+    // Points of V that are not projections, sorted by cell at the first pull. The points of cells[i] that are not
+    // pulled yet are points[cell_begin[i], cell_end[i]).
+    std::vector<int> points;
+    bool sorted = true;
+    std::vector<int> cells;
+    std::vector<int> cell_begin;
+    std::vector<int> cell_end;
+    // Projections that are not pulled yet, in any order.
+    std::vector<int> projections;
+  };
+
+  void sort(Layer& layer);
+  void remove_projection(Layer& layer, int v_point_index);
+  // Returns the index of the cell in the layer, -1 if the layer has no point in this cell.
+  int find_cell(const Layer& layer, int cell) const;
+
+  const Persistence_graph& g;
+  Neighbors_grid grid;
+  std::vector<Layer> layers;
+  // Layer of each point of V, -1 if it is not in the finder, and position of each projection in its layer.
+  std::vector<int> v_layer;
+  std::vector<int> projection_position;
+};
+
+/** \internal \brief data structure used to find any point (including projections) in V near to a query point from U
+ * (which can be a projection). Same as Neighbors_finder, with a Neighbors_grid instead of a kd-tree.
+ *
+ * V points have to be added manually using their index and before the first pull. A neighbor pulled is automatically
+ * removed.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Grid_neighbors_finder {
+ public:
+  /** \internal \brief Constructor taking the grid of the near distance as parameter. */
+  Grid_neighbors_finder(const Persistence_graph& g, const Neighbors_grid& grid);
+  /** \internal \brief A point added will be possibly pulled. */
+  void add(int v_point_index);
+  /** \internal \brief Returns and remove a V point near to the U point given as parameter, null_point_index() if
+   * there isn't such a point. */
+  int pull_near(int u_point_index);
+  /** \internal \brief Returns and remove all the V points near to the U point given as parameter. */
+  std::vector<int> pull_all_near(int u_point_index);
+
+ private:
+  Layered_grid_neighbors_finder layered_nf;
+};
+
+inline Neighbors_grid::Neighbors_grid() : radius(0.), cells() { }
+
+inline Neighbors_grid::Neighbors_grid(const Persistence_graph& g, double r, const Neighbors_grid& previous)
+    : radius(r), cells(previous.cells) {
+  // The cells are a bit larger than r, so that rounding errors cannot hide a point at distance exactly r.
+  double cell_size = r + std::ldexp(r, -20);
+  if (!cells || cells->cell_size < cell_size ||
+      cells->cell_size > 2 * (std::max)(cell_size, cells->min_cell_size))
+    cells = build_cells(g, cell_size);
+}
+
+inline std::shared_ptr<const Neighbors_grid::Cells> Neighbors_grid::build_cells(const Persistence_graph& g,
+                                                                                 double cell_size) {
+  std::shared_ptr<Cells> result = std::make_shared<Cells>();
+  int v_points_number = 0;
+  while (v_points_number < g.size() && !g.on_the_v_diagonal(v_points_number)) ++v_points_number;
+  double min_x = 0., max_x = 0., min_y = 0., max_y = 0.;
+  for (int v_point_index = 0; v_point_index < v_points_number; ++v_point_index) {
+    Internal_point p = g.get_v_point(v_point_index);
+    if (v_point_index == 0) {
+      min_x = max_x = p.x();
+      min_y = max_y = p.y();
+    }
+    min_x = (std::min)(min_x, p.x());
+    max_x = (std::max)(max_x, p.x());
+    min_y = (std::min)(min_y, p.y());
+    max_y = (std::max)(max_y, p.y());
+  }
+  double extent = (std::max)(max_x - min_x, max_y - min_y);
+  result->min_cell_size = extent > 0. ? std::ldexp(extent, -24) : 1.;
+  result->cell_size = (std::max)(cell_size, result->min_cell_size);
+  const double max_index = std::floor(extent / result->cell_size);
+  auto key = [](double x_index, double y_index) {
+    return (static_cast<std::uint64_t>(x_index) << 32) | static_cast<std::uint64_t>(y_index);
+  };
+
+  std::vector<std::uint64_t> v_keys;
+  for (int v_point_index = 0; v_point_index < v_points_number; ++v_point_index) {
+    Internal_point p = g.get_v_point(v_point_index);
+    v_keys.push_back(key((std::min)(std::floor((p.x() - min_x) / result->cell_size), max_index),
+                         (std::min)(std::floor((p.y() - min_y) / result->cell_size), max_index)));
+  }
+  std::vector<std::uint64_t> cell_keys(v_keys);
+  std::sort(cell_keys.begin(), cell_keys.end());
+  cell_keys.erase(std::unique(cell_keys.begin(), cell_keys.end()), cell_keys.end());
+  for (std::uint64_t k : v_keys)
+    result->v_cell.push_back(std::lower_bound(cell_keys.begin(), cell_keys.end(), k) - cell_keys.begin());
+
+  result->u_cells_start.push_back(0);
+  for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index) {
+    Internal_point p = g.get_u_point(u_point_index);
+    // The points of U can be far outside the bounding box of V: their indices are clamped, so that the loops below
+    // run over small integers.
+    auto clamp_index = [&](double coordinate, double min_coordinate) {
+      double index = std::floor((coordinate - min_coordinate) / result->cell_size);
+      return static_cast<std::int64_t>((std::min)((std::max)(index, -1.), max_index + 1));
+    };
+    std::int64_t x_index = clamp_index(p.x(), min_x);
+    std::int64_t y_index = clamp_index(p.y(), min_y);
+    // The keys are sorted by x then y, so are the cells found.
+    for (std::int64_t i = x_index - 1; i <= x_index + 1; ++i) {
+      for (std::int64_t j = y_index - 1; j <= y_index + 1; ++j) {
+        if (i < 0 || i > max_index || j < 0 || j > max_index) continue;
+        std::uint64_t k = key(i, j);
+        auto it = std::lower_bound(cell_keys.begin(), cell_keys.end(), k);
+        if (it != cell_keys.end() && *it == k) result->u_cells.push_back(it - cell_keys.begin());
+      }
+    }
+    result->u_cells_start.push_back(result->u_cells.size());
+  }
+  return result;
+}
+
+inline double Neighbors_grid::r() const {
+  return radius;
+}
+
+inline int Neighbors_grid::v_cell(int v_point_index) const {
+  return cells->v_cell[v_point_index];
+}
+
+inline const int* Neighbors_grid::u_cells_begin(int u_point_index) const {
+  return cells->u_cells.data() + cells->u_cells_start[u_point_index];
+}
+
+inline const int* Neighbors_grid::u_cells_end(int u_point_index) const {
+  return cells->u_cells.data() + cells->u_cells_start[u_point_index + 1];
+}
+
+inline Layered_grid_neighbors_finder::Layered_grid_neighbors_finder(const Persistence_graph& g,
+                                                                    const Neighbors_grid& grid)
+    : g(g), grid(grid), layers(), v_layer(g.size(), -1), projection_position(g.size(), -1) { }
+
+inline void Layered_grid_neighbors_finder::add(int v_point_index, int vlayer) {
+  if (static_cast<int> (layers.size()) <= vlayer)
+    layers.resize(vlayer + 1);
+  Layer& layer = layers[vlayer];
+  v_layer[v_point_index] = vlayer;
+  if (g.on_the_v_diagonal(v_point_index)) {
+    projection_position[v_point_index] = layer.projections.size();
+    layer.projections.push_back(v_point_index);
+  } else {
+    layer.points.push_back(v_point_index);
+    layer.sorted = false;
+  }
+}
+
+inline void Layered_grid_neighbors_finder::sort(Layer& layer) {
+  std::sort(layer.points.begin(), layer.points.end(), [this](int p, int q) {
+    return grid.v_cell(p) < grid.v_cell(q);
+  });
+  for (int i = 0; i < static_cast<int> (layer.points.size()); ++i) {
+    int cell = grid.v_cell(layer.points[i]);
+    if (layer.cells.empty() || layer.cells.back() != cell) {
+      layer.cells.push_back(cell);
+      layer.cell_begin.push_back(i);
+      layer.cell_end.push_back(i);
+    }
+    ++layer.cell_end.back();
+  }
+  layer.sorted = true;
+}
+
+inline void Layered_grid_neighbors_finder::remove_projection(Layer& layer, int v_point_index) {
+  int last = layer.projections.back();
+  layer.projections[projection_position[v_point_index]] = last;
+  projection_position[last] = projection_position[v_point_index];
+  layer.projections.pop_back();
+  v_layer[v_point_index] = -1;
+}
+
+inline int Layered_grid_neighbors_finder::find_cell(const Layer& layer, int cell) const {
+  auto it = std::lower_bound(layer.cells.begin(), layer.cells.end(), cell);
+  if (it == layer.cells.end() || *it != cell)
+    return -1;
+  return it - layer.cells.begin();
+}
+
+inline int Layered_grid_neighbors_finder::pull_near(int u_point_index, int vlayer) {
+  if (static_cast<int> (layers.size()) <= vlayer)
+    return null_point_index();
+  Layer& layer = layers[vlayer];
+  int c = g.corresponding_point_in_v(u_point_index);
+  if (g.on_the_u_diagonal(u_point_index) && !layer.projections.empty()) {
+    // Any pair of projection is at distance 0
+    int tmp = layer.projections.back();
+    remove_projection(layer, tmp);
+    return tmp;
+  }
+  if (g.on_the_v_diagonal(c) && v_layer[c] == vlayer && g.distance(u_point_index, c) <= grid.r()) {
+    // Is the query point near to its projection ?
+    remove_projection(layer, c);
+    return c;
+  }
+  // Is the query point near to a V point in the plane ?
+  if (!layer.sorted) sort(layer);
+  for (const int* cell = grid.u_cells_begin(u_point_index); cell != grid.u_cells_end(u_point_index); ++cell) {
+    int i = find_cell(layer, *cell);
+    if (i == -1) continue;
+    for (int j = layer.cell_begin[i]; j < layer.cell_end[i]; ++j) {
+      int tmp = layer.points[j];
+      if (g.distance(u_point_index, tmp) <= grid.r()) {
+        std::swap(layer.points[j], layer.points[--layer.cell_end[i]]);
+        v_layer[tmp] = -1;
+        return tmp;
+      }
+    }
+  }
+  return null_point_index();
+}
+
+inline std::vector<int> Layered_grid_neighbors_finder::pull_all_near(int u_point_index, int vlayer) {
+  std::vector<int> all_pull;
+  if (static_cast<int> (layers.size()) <= vlayer)
+    return all_pull;
+  Layer& layer = layers[vlayer];
+  // The projections first, as with successive calls to pull_near.
+  int tmp = pull_near(u_point_index, vlayer);
+  while (tmp != null_point_index() && g.on_the_v_diagonal(tmp)) {
+    all_pull.push_back(tmp);
+    tmp = pull_near(u_point_index, vlayer);
+  }
+  if (tmp == null_point_index())
+    return all_pull;
+  all_pull.push_back(tmp);
+  // Each cell is scanned once for the other points.
+  for (const int* cell = grid.u_cells_begin(u_point_index); cell != grid.u_cells_end(u_point_index); ++cell) {
+    int i = find_cell(layer, *cell);
+    if (i == -1) continue;
+    for (int j = layer.cell_begin[i]; j < layer.cell_end[i];) {
+      tmp = layer.points[j];
+      if (g.distance(u_point_index, tmp) <= grid.r()) {
+        std::swap(layer.points[j], layer.points[--layer.cell_end[i]]);
+        v_layer[tmp] = -1;
+        all_pull.push_back(tmp);
+      } else {
+        ++j;
+      }
+    }
+  }
+  return all_pull;
+}
+
+inline int Layered_grid_neighbors_finder::vlayers_number() const {
+  return static_cast<int> (layers.size());
+}
+
+inline Grid_neighbors_finder::Grid_neighbors_finder(const Persistence_graph& g, const Neighbors_grid& grid)
+    : layered_nf(g, grid) { }
+
+inline void Grid_neighbors_finder::add(int v_point_index) {
+  layered_nf.add(v_point_index, 0);
+}
+
+inline int Grid_neighbors_finder::pull_near(int u_point_index) {
+  return layered_nf.pull_near(u_point_index, 0);
+}
+
+inline std::vector<int> Grid_neighbors_finder::pull_all_near(int u_point_index) {
+  return layered_nf.pull_all_near(u_point_index, 0);
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // GRID_NEIGHBORS_FINDER_H_
@@ -22,6 +22,7 @@
 #include <vector>
 #include <algorithm>
 #include <limits>  // for numeric_limits
+#include <cmath>  // for std::fabs
 
 namespace Gudhi {
 
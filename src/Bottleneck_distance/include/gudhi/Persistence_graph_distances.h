@@ -0,0 +1,177 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef PERSISTENCE_GRAPH_DISTANCES_H_
+#define PERSISTENCE_GRAPH_DISTANCES_H_
+
+#include <gudhi/Persistence_graph.h>
+#include <gudhi/Internal_point.h>
+
+#include <vector>
+#include <algorithm>  // for std::sort, std::lower_bound, std::partition_point
+#include <numeric>  // for std::iota
+#include <initializer_list>
+#include <cmath>  // for std::fabs
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief Implicit set of the distances between the points of a Persistence_graph, the ones that
+ * Persistence_graph::sorted_distances() lists, with counting and listing of the distances in a range in
+ * O(n log n) time and O(n) memory, n being the size of the graph.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Persistence_graph_distances {
+ public:
+  /** \internal \brief Constructor, the graph must outlive this object. */
+  explicit Persistence_graph_distances(const Persistence_graph& g);
+  /** \internal \brief Returns an upper bound of the distances. */
+  double upper_bound() const;
+  /** \internal \brief Returns the number of pairs of points at distance at most r. The pairs at distance very close
+   * to r may be counted wrong because of rounding errors, so it must not be used to decide which distances exist. */
+  std::size_t count(double r) const;
+  /** \internal \brief Returns the sorted distances d such that lower < d <= upper, without repetition. */
+  std::vector<double> sorted_distances(double lower, double upper) const;
+
+ private:
+  // Points sorted by x, with the rank of their y coordinate.
+  struct Point_set {
+    std::vector<Internal_point> points;
+    std::vector<double> sorted_y;
+    std::vector<std::size_t> y_rank;
+    void sort();
+  };
+
+  static std::size_t count(const Point_set& ps, const Point_set& qs, double r);
+  static void distances(const Point_set& ps, const Point_set& qs, double lower, double upper,
+                        std::vector<double>& result);
+
+  Point_set u_points;
+  // Projections on the diagonal of the points of V, in U
+  Point_set u_projections;
+  Point_set v_points;
+  // Projections on the diagonal of the points of U, in V
+  Point_set v_projections;
+};
+
+inline void Persistence_graph_distances::Point_set::sort() {
+  std::sort(points.begin(), points.end(),
+            [](const Internal_point& p, const Internal_point& q) { return p.x() < q.x(); });
+  std::vector<std::size_t> by_y(points.size());
+  std::iota(by_y.begin(), by_y.end(), 0);
+  std::sort(by_y.begin(), by_y.end(), [this](std::size_t i, std::size_t j) { return points[i].y() < points[j].y(); });
+  sorted_y.resize(points.size());
+  y_rank.resize(points.size());
+  for (std::size_t i = 0; i != by_y.size(); ++i) {
+    sorted_y[i] = points[by_y[i]].y();
+    y_rank[by_y[i]] = i;
+  }
+}
+
+inline Persistence_graph_distances::Persistence_graph_distances(const Persistence_graph& g) {
+  for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index) {
+    if (g.on_the_u_diagonal(u_point_index))
+      u_projections.points.push_back(g.get_u_point(u_point_index));
+    else
+      u_points.points.push_back(g.get_u_point(u_point_index));
+  }
+  for (int v_point_index = 0; v_point_index < g.size(); ++v_point_index) {
+    if (g.on_the_v_diagonal(v_point_index))
+      v_projections.points.push_back(g.get_v_point(v_point_index));
+    else
+      v_points.points.push_back(g.get_v_point(v_point_index));
+  }
+  u_points.sort();
+  u_projections.sort();
+  v_points.sort();
+  v_projections.sort();
+}
+
+inline double Persistence_graph_distances::upper_bound() const {
+  // The rounding of a difference is monotone, so the largest difference bounds all the others.
+  double min_x = 0., max_x = 0., min_y = 0., max_y = 0.;
+  bool empty = true;
+  for (const Point_set* ps : {&u_points, &u_projections, &v_points, &v_projections}) {
+    for (const Internal_point& p : ps->points) {
+      if (empty || p.x() < min_x) min_x = p.x();
+      if (empty || p.x() > max_x) max_x = p.x();
+      if (empty || p.y() < min_y) min_y = p.y();
+      if (empty || p.y() > max_y) max_y = p.y();
+      empty = false;
+    }
+  }
+  return (std::max)(max_x - min_x, max_y - min_y);
+}
+
+inline std::size_t Persistence_graph_distances::count(double r) const {
+  if (r < 0.) return 0;
+  // Any pair of projections is at distance 0
+  return count(u_points, v_points, r) + count(u_points, v_projections, r) + count(u_projections, v_points, r) +
+         u_projections.points.size() * v_projections.points.size();
+}
+
+inline std::vector<double> Persistence_graph_distances::sorted_distances(double lower, double upper) const {
+  std::vector<double> result;
+  if (lower < 0. && 0. <= upper) result.push_back(0.);
+  distances(u_points, v_points, lower, upper, result);
+  distances(u_points, v_projections, lower, upper, result);
+  distances(u_projections, v_points, lower, upper, result);
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+inline std::size_t Persistence_graph_distances::count(const Point_set& ps, const Point_set& qs, double r) {
+  // Sweep of the points of ps by increasing x, with the points of qs in the vertical strip of width 2r around the
+  // current point in a Fenwick tree indexed by the rank of their y coordinate.
+  std::vector<std::size_t> tree(qs.points.size() + 1, 0);
+  auto prefix_count = [&tree](std::size_t rank) {
+    std::size_t result = 0;
+    for (; rank != 0; rank -= rank & (~rank + 1)) result += tree[rank];
+    return result;
+  };
+  std::size_t first = 0;
+  std::size_t last = 0;
+  std::size_t result = 0;
+  for (const Internal_point& p : ps.points) {
+    for (; last != qs.points.size() && qs.points[last].x() <= p.x() + r; ++last)
+      for (std::size_t i = qs.y_rank[last] + 1; i < tree.size(); i += i & (~i + 1)) ++tree[i];
+    for (; first != last && qs.points[first].x() < p.x() - r; ++first)
+      for (std::size_t i = qs.y_rank[first] + 1; i < tree.size(); i += i & (~i + 1)) --tree[i];
+    std::size_t below = std::lower_bound(qs.sorted_y.begin(), qs.sorted_y.end(), p.y() - r) - qs.sorted_y.begin();
+    std::size_t above = std::upper_bound(qs.sorted_y.begin(), qs.sorted_y.end(), p.y() + r) - qs.sorted_y.begin();
+    if (below < above) result += prefix_count(above) - prefix_count(below);
+  }
+  return result;
+}
+
+inline void Persistence_graph_distances::distances(const Point_set& ps, const Point_set& qs, double lower,
+                                                   double upper, std::vector<double>& result) {
+  for (const Internal_point& p : ps.points) {
+    // The rounding of the difference of x coordinates is monotone, so the points of qs at distance at most upper in
+    // x are contiguous, and they are found with the same computation as Persistence_graph::distance().
+    auto begin = std::partition_point(qs.points.begin(), qs.points.end(), [&p, upper](const Internal_point& q) {
+      return q.x() < p.x() && std::fabs(p.x() - q.x()) > upper;
+    });
+    auto end = std::partition_point(begin, qs.points.end(), [&p, upper](const Internal_point& q) {
+      return q.x() <= p.x() || std::fabs(p.x() - q.x()) <= upper;
+    });
+    for (auto q = begin; q != end; ++q) {
+      double d = (std::max)(std::fabs(p.x() - q->x()), std::fabs(p.y() - q->y()));
+      if (lower < d && d <= upper) result.push_back(d);
+    }
+  }
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENCE_GRAPH_DISTANCES_H_
@@ -0,0 +1,352 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef WASSERSTEIN_H_
+#define WASSERSTEIN_H_
+
+#include <gudhi/Persistence_graph.h>
+#include <gudhi/Weighted_neighbors_finder.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
+#include <set>
+#include <utility>  // for std::pair
+#include <iterator>  // for std::begin, std::end
+#include <algorithm>  // for std::sort, std::max
+#include <limits>  // for numeric_limits
+#include <cmath>  // for std::fabs, std::pow, std::nextafter
+#include <stdexcept>  // for std::invalid_argument
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief Auction algorithm for the minimal cost perfect matching between U and V in a Persistence_graph,
+ * the cost of an edge being its length to the power order.
+ *
+ * Only the edges needed by an optimal matching are considered: a point of U that is not a projection can be matched
+ * to any point of V that is not a projection, or to its own projection, at the cost of its distance to the diagonal.
+ * A projection in U can be matched to its own projector, or to any projection in V at cost 0.
+ *
+ * The points of U bid for the points of V, which are sold to the highest bidder. The bids of the unassigned points
+ * of U that are not projections are computed in parallel, from the same prices, then the points of V are sold (Jacobi
+ * auction). The projections in U, which all compete for the cheapest projections in V, bid one after the other
+ * (Gauss-Seidel auction). The best point of V for a bidder that is not a projection is found with a
+ * Weighted_neighbors_finder, whose weights are the prices. The auction
+ * is repeated with a decreasing epsilon (epsilon-scaling), starting from the prices of the previous round and the
+ * part of its matching that is still epsilon-optimal for the new epsilon.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Wasserstein_auction {
+ public:
+  /** \internal \brief Constructor, the graph must outlive this object. */
+  Wasserstein_auction(const Persistence_graph& g, double order);
+  /** \internal \brief Returns the cost of a matching, which is at most (1 + delta)^order times the minimal cost. */
+  double run(double delta);
+
+ private:
+  struct Bid {
+    int v_point_index;
+    double price;
+    // Second best point of V for the bidder
+    int second_v_point_index;
+  };
+
+  // Cost of an edge that can be used.
+  double cost(int u_point_index, int v_point_index) const;
+  double price(int v_point_index) const;
+  void set_price(int v_point_index, double price);
+  // The best and second best points of V for u_point_index, with their cost plus price.
+  void find_two_best(int u_point_index, Weighted_neighbor& best, Weighted_neighbor& second) const;
+  // Replaces best or second with v_point_index if it is better for u_point_index.
+  void consider(int u_point_index, int v_point_index, Weighted_neighbor& best, Weighted_neighbor& second) const;
+  Bid bid(int u_point_index, double epsilon) const;
+  // Gives the point of V of the bid to u_point_index, and returns its previous owner.
+  int assign(int u_point_index, const Bid& b);
+  // Auction until all the points of U are assigned.
+  void auction(double epsilon);
+  // Returns the minimal cost plus price of each point of U, and a lower bound of the minimal cost.
+  double dual_bound(std::vector<double>& best_values) const;
+
+  const Persistence_graph& g;
+  double order;
+  int u_size;  // number of points of U that are not projections
+  int v_size;  // number of points of V that are not projections
+  // Prices of the points of V that are not projections
+  Weighted_neighbors_finder finder;
+  // Prices of the projections in V, also sorted
+  std::vector<double> projection_prices;
+  std::set<std::pair<double, int>> sorted_projection_prices;
+  // Distance of the points of U and V to the diagonal, to the power order
+  std::vector<double> u_diagonal_costs;
+  std::vector<double> v_diagonal_costs;
+  std::vector<int> u_to_v;
+  std::vector<int> v_to_u;
+  std::vector<int> unassigned;
+  // The best and second best points of V of the last bid of each point of U. As the prices only increase, they are
+  // good initial values for its next search.
+  std::vector<int> last_best;
+  std::vector<int> last_second;
+};
+
+inline Wasserstein_auction::Wasserstein_auction(const Persistence_graph& g, double order)
+    : g(g), order(order), u_size(0), v_size(0), finder(g, order),
+      u_to_v(g.size(), null_point_index()), v_to_u(g.size(), null_point_index()),
+      last_best(g.size(), null_point_index()), last_second(g.size(), null_point_index()) {
+  while (u_size < g.size() && !g.on_the_u_diagonal(u_size)) ++u_size;
+  while (v_size < g.size() && !g.on_the_v_diagonal(v_size)) ++v_size;
+  for (int u_point_index = 0; u_point_index < u_size; ++u_point_index)
+    u_diagonal_costs.push_back(finder.power(g.distance(u_point_index, g.corresponding_point_in_v(u_point_index))));
+  for (int v_point_index = 0; v_point_index < v_size; ++v_point_index)
+    v_diagonal_costs.push_back(finder.power(g.distance(g.corresponding_point_in_u(v_point_index), v_point_index)));
+  projection_prices.resize(u_size, 0.);
+  for (int i = 0; i < u_size; ++i) sorted_projection_prices.emplace(0., v_size + i);
+}
+
+inline double Wasserstein_auction::cost(int u_point_index, int v_point_index) const {
+  if (!g.on_the_u_diagonal(u_point_index)) {
+    if (!g.on_the_v_diagonal(v_point_index)) return finder.power(g.distance(u_point_index, v_point_index));
+    return u_diagonal_costs[u_point_index];
+  }
+  if (!g.on_the_v_diagonal(v_point_index)) return v_diagonal_costs[v_point_index];
+  return 0.;
+}
+
+inline double Wasserstein_auction::price(int v_point_index) const {
+  return g.on_the_v_diagonal(v_point_index) ? projection_prices[v_point_index - v_size] : finder.weight(v_point_index);
+}
+
+inline void Wasserstein_auction::set_price(int v_point_index, double price) {
+  if (g.on_the_v_diagonal(v_point_index)) {
+    double& old_price = projection_prices[v_point_index - v_size];
+    sorted_projection_prices.erase(std::make_pair(old_price, v_point_index));
+    sorted_projection_prices.emplace(price, v_point_index);
+    old_price = price;
+  } else {
+    finder.set_weight(v_point_index, price);
+  }
+}
+
+inline void Wasserstein_auction::consider(int u_point_index, int v_point_index, Weighted_neighbor& best,
+                                          Weighted_neighbor& second) const {
+  if (v_point_index == null_point_index() || v_point_index == best.v_point_index ||
+      v_point_index == second.v_point_index)
+    return;
+  Weighted_neighbor candidate;
+  candidate.v_point_index = v_point_index;
+  candidate.value = cost(u_point_index, v_point_index) + price(v_point_index);
+  if (candidate.value < best.value) {
+    second = best;
+    best = candidate;
+  } else if (candidate.value < second.value) {
+    second = candidate;
+  }
+}
+
+inline void Wasserstein_auction::find_two_best(int u_point_index, Weighted_neighbor& best,
+                                               Weighted_neighbor& second) const {
+  // The corresponding point is always a choice.
+  best.v_point_index = g.corresponding_point_in_v(u_point_index);
+  best.value = cost(u_point_index, best.v_point_index) + price(best.v_point_index);
+  second = Weighted_neighbor();
+  if (!g.on_the_u_diagonal(u_point_index)) {
+    // The points of the last bid bound the search from the start, which then prunes most of the 2d-tree.
+    consider(u_point_index, u_to_v[u_point_index], best, second);
+    consider(u_point_index, last_best[u_point_index], best, second);
+    consider(u_point_index, last_second[u_point_index], best, second);
+    finder.find_two_best(g.get_u_point(u_point_index), best, second);
+    return;
+  }
+  // The projections in V all have cost 0 for a projection, the best ones are the cheapest.
+  auto it = sorted_projection_prices.begin();
+  for (int i = 0; i < 2 && it != sorted_projection_prices.end(); ++i, ++it) {
+    Weighted_neighbor candidate;
+    candidate.v_point_index = it->second;
+    candidate.value = it->first;
+    if (candidate.value < best.value) {
+      second = best;
+      best = candidate;
+    } else if (candidate.value < second.value) {
+      second = candidate;
+    }
+  }
+}
+
+inline Wasserstein_auction::Bid Wasserstein_auction::bid(int u_point_index, double epsilon) const {
+  Weighted_neighbor best, second;
+  find_two_best(u_point_index, best, second);
+  // Without another choice, the price only increases by epsilon.
+  double increment = second.v_point_index == null_point_index() ? 0. : second.value - best.value;
+  double old_price = price(best.v_point_index);
+  // The price must increase even if epsilon is lost in the rounding.
+  return Bid{best.v_point_index,
+             (std::max)(old_price + increment + epsilon,
+                        std::nextafter(old_price, std::numeric_limits<double>::infinity())),
+             second.v_point_index};
+}
+
+inline int Wasserstein_auction::assign(int u_point_index, const Bid& b) {
+  int previous_owner = v_to_u[b.v_point_index];
+  if (previous_owner != null_point_index()) u_to_v[previous_owner] = null_point_index();
+  v_to_u[b.v_point_index] = u_point_index;
+  u_to_v[u_point_index] = b.v_point_index;
+  set_price(b.v_point_index, b.price);
+  return previous_owner;
+}
+
+inline void Wasserstein_auction::auction(double epsilon) {
+  std::vector<int> bidders;
+  std::vector<Bid> bids;
+  std::vector<int> still_unassigned;
+  while (!unassigned.empty()) {
+    // The projections in U all want the cheapest projections in V, so they bid one after the other, and each bid
+    // takes the previous ones into account.
+    bidders.clear();
+    still_unassigned.clear();
+    for (int u_point_index : unassigned) {
+      if (!g.on_the_u_diagonal(u_point_index)) {
+        bidders.push_back(u_point_index);
+        continue;
+      }
+      int previous_owner = assign(u_point_index, bid(u_point_index, epsilon));
+      if (previous_owner != null_point_index()) still_unassigned.push_back(previous_owner);
+    }
+    // The other bids are computed in parallel, from the same prices. A bid that is not higher than the current price
+    // of its point when it is processed is lost.
+    bids.resize(bidders.size());
+    auto compute_bid = [&](std::size_t i) { bids[i] = bid(bidders[i], epsilon); };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), bidders.size(), compute_bid);
+#else
+    for (std::size_t i = 0; i < bidders.size(); ++i) compute_bid(i);
+#endif
+    for (std::size_t i = 0; i < bidders.size(); ++i) {
+      last_best[bidders[i]] = bids[i].v_point_index;
+      last_second[bidders[i]] = bids[i].second_v_point_index;
+      if (bids[i].price <= price(bids[i].v_point_index)) {
+        still_unassigned.push_back(bidders[i]);
+        continue;
+      }
+      int previous_owner = assign(bidders[i], bids[i]);
+      if (previous_owner != null_point_index()) still_unassigned.push_back(previous_owner);
+    }
+    unassigned.swap(still_unassigned);
+  }
+}
+
+inline double Wasserstein_auction::dual_bound(std::vector<double>& best_values) const {
+  // With b_v = -price(v) and a_u the minimal cost plus price for u, a_u + b_v <= cost(u, v) for all the edges, so
+  // the sum of the a_u and b_v is a lower bound of the cost of any perfect matching (linear programming duality).
+  best_values.resize(g.size());
+  auto compute_best_value = [&](std::size_t u_point_index) {
+    Weighted_neighbor best, second;
+    find_two_best(u_point_index, best, second);
+    best_values[u_point_index] = best.value;
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(std::size_t(0), best_values.size(), compute_best_value);
+#else
+  for (std::size_t u_point_index = 0; u_point_index < best_values.size(); ++u_point_index)
+    compute_best_value(u_point_index);
+#endif
+  double bound = 0.;
+  for (int i = 0; i < g.size(); ++i) bound += best_values[i] - price(i);
+  return bound;
+}
+
+inline double Wasserstein_auction::run(double delta) {
+  if (g.size() == 0) return 0.;
+  double diagonal_cost = 0.;
+  for (double c : u_diagonal_costs) diagonal_cost += c;
+  for (double c : v_diagonal_costs) diagonal_cost += c;
+  // A fraction of the average cost of matching a point with the diagonal
+  double epsilon = diagonal_cost / g.size() / 4.;
+  double lower_bound = 0.;
+  double ratio = std::pow(1. + delta, order);
+  std::vector<double> best_values;
+  for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index) unassigned.push_back(u_point_index);
+  while (true) {
+    auction(epsilon);
+    double total_cost = 0.;
+    for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
+      total_cost += cost(u_point_index, u_to_v[u_point_index]);
+    lower_bound = (std::max)(lower_bound, dual_bound(best_values));
+    if (total_cost == 0. || total_cost <= ratio * lower_bound) return total_cost;
+    // The exact computation stops when epsilon is lost in the rounding errors of the costs and prices.
+    double scale = total_cost;
+    for (double value : best_values) scale = (std::max)(scale, std::fabs(value));
+    if (epsilon <= scale * std::numeric_limits<double>::epsilon()) return total_cost;
+    epsilon /= 5.;
+    // Warm start: the pairs that satisfy epsilon-complementary slackness for the new epsilon are kept.
+    for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index) {
+      int v_point_index = u_to_v[u_point_index];
+      if (cost(u_point_index, v_point_index) + price(v_point_index) > best_values[u_point_index] + epsilon) {
+        u_to_v[u_point_index] = null_point_index();
+        v_to_u[v_point_index] = null_point_index();
+        unassigned.push_back(u_point_index);
+      }
+    }
+  }
+}
+
+/** \brief Function to compute the Wasserstein distance between two persistence diagrams.
+ *
+ * The Wasserstein distance of order p is the p-th root of the minimal sum of the p-th powers of the distances between
+ * matched points, over the matchings between the diagrams where some points are matched to the diagonal. Like in
+ * `bottleneck_distance()`, the distance between two points is the \f$ L^\infty \f$ distance. The points at infinity
+ * (essential classes) are matched among themselves, sorted by birth, and the distance is \f$ +\infty \f$ if the
+ * diagrams do not have the same number of them.
+ *
+ * The matching of the other points is computed with an auction algorithm with epsilon-scaling, where the best point
+ * for a bidder is found with a 2d-tree whose nodes store the smallest price of their points. The bids are computed in
+ * parallel if TBB is available.
+ *
+ * \tparam Persistence_diagram1,Persistence_diagram2
+ * models of the concept `PersistenceDiagram`.
+ * \param[in] diag1 The first persistence diagram.
+ * \param[in] diag2 The second persistence diagram.
+ * \param[in] order The order p of the distance, at least 1.
+ * \param[in] delta The maximal relative error: the result is at most (1 + delta) times the distance. With delta = 0,
+ * the computation goes on until the matching is optimal, up to rounding errors, which is much slower.
+ * \exception std::invalid_argument If order is less than 1 or delta is negative.
+ * \return The Wasserstein distance of order p, up to the relative error delta.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+double wasserstein_distance(const Persistence_diagram1& diag1, const Persistence_diagram2& diag2,
+                            double order = 1., double delta = 0.01) {
+  if (!(order >= 1.)) throw std::invalid_argument("The order of the Wasserstein distance must be at least 1");
+  if (!(delta >= 0.)) throw std::invalid_argument("The relative error must be non negative");
+  std::vector<double> u_alive;
+  std::vector<double> v_alive;
+  for (auto it = std::begin(diag1); it != std::end(diag1); ++it)
+    if (std::get<1>(*it) == std::numeric_limits<double>::infinity()) u_alive.push_back(std::get<0>(*it));
+  for (auto it = std::begin(diag2); it != std::end(diag2); ++it)
+    if (std::get<1>(*it) == std::numeric_limits<double>::infinity()) v_alive.push_back(std::get<0>(*it));
+  if (u_alive.size() != v_alive.size()) return std::numeric_limits<double>::infinity();
+  std::sort(u_alive.begin(), u_alive.end());
+  std::sort(v_alive.begin(), v_alive.end());
+  double alive_cost = 0.;
+  for (std::size_t i = 0; i < u_alive.size(); ++i) alive_cost += std::pow(std::fabs(u_alive[i] - v_alive[i]), order);
+
+  // The points on the diagonal do not change the distance.
+  Persistence_graph g(diag1, diag2, 0.);
+  Wasserstein_auction auction(g, order);
+  return std::pow(auction.run(delta) + alive_cost, 1. / order);
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // WASSERSTEIN_H_
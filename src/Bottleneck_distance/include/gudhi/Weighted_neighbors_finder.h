@@ -0,0 +1,228 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef WEIGHTED_NEIGHBORS_FINDER_H_
+#define WEIGHTED_NEIGHBORS_FINDER_H_
+
+#include <gudhi/Persistence_graph.h>
+#include <gudhi/Internal_point.h>
+
+#include <vector>
+#include <algorithm>  // for std::nth_element, std::max, std::min
+#include <utility>  // for std::swap
+#include <limits>  // for numeric_limits
+#include <cmath>  // for std::fabs, std::pow
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief A point of V with its value for a query point of U.
+ *
+ * \ingroup bottleneck_distance
+ */
+struct Weighted_neighbor {
+  int v_point_index = null_point_index();
+  double value = std::numeric_limits<double>::infinity();
+};
+
+/** \internal \brief Data structure used to find the points of V that are not projections and that minimize their
+ * distance to a point of U, to the power order, plus their weight. The weights can be modified between the queries.
+ *
+ * It is a 2d-tree on the points of V, whose nodes store the bounding box of their points and their minimal weight,
+ * so that the search skips the nodes whose best possible value is not better than the values already found. With
+ * order 1, the nodes also store the minimal weight plus or minus each coordinate of their points, which bounds the
+ * value of the points that are far from the query point but cheap.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Weighted_neighbors_finder {
+ public:
+  /** \internal \brief Constructor, all the weights are 0. */
+  Weighted_neighbors_finder(const Persistence_graph& g, double order);
+  /** \internal \brief Returns the distance, to the power order. */
+  double power(double distance) const;
+  /** \internal \brief Returns the weight of a point of V that is not a projection. */
+  double weight(int v_point_index) const;
+  /** \internal \brief Modifies the weight of a point of V that is not a projection, in O(log n). */
+  void set_weight(int v_point_index, double weight);
+  /** \internal \brief Replaces best and second, which must be sorted, with the two points of V that are not
+   * projections with the smallest values for the point p if they are better. Good initial values make the search
+   * faster. */
+  void find_two_best(const Internal_point& p, Weighted_neighbor& best, Weighted_neighbor& second) const;
+
+ private:
+  struct Node {
+    double min_x, max_x, min_y, max_y;
+    double min_weight;
+    // Minimal weight plus or minus a coordinate, for the lower bounds of order 1, only maintained for order 1
+    double min_weight_plus_x, min_weight_minus_x, min_weight_plus_y, min_weight_minus_y;
+    // The points of the node are points[begin, end), and the children are the two nodes after a node.
+    int begin, end;
+    int parent;
+    int right_child;  // the left child follows the node, a leaf has no right child
+  };
+
+  static const int max_leaf_size = 8;
+
+  int build(int begin, int end, int parent, bool split_x);
+  void search(int node, const Internal_point& p, Weighted_neighbor& best, Weighted_neighbor& second) const;
+  void update(int node);
+
+  double order;
+  std::vector<Internal_point> points;
+  std::vector<Node> nodes;
+  std::vector<double> weights;
+  // Leaf of each point of V
+  std::vector<int> leaf;
+};
+
+inline Weighted_neighbors_finder::Weighted_neighbors_finder(const Persistence_graph& g, double order)
+    : order(order) {
+  for (int v_point_index = 0; v_point_index < g.size() && !g.on_the_v_diagonal(v_point_index); ++v_point_index)
+    points.push_back(g.get_v_point(v_point_index));
+  weights.resize(points.size(), 0.);
+  leaf.resize(points.size());
+  if (!points.empty()) build(0, points.size(), -1, true);
+}
+
+inline int Weighted_neighbors_finder::build(int begin, int end, int parent, bool split_x) {
+  int node = nodes.size();
+  nodes.push_back(Node());
+  nodes[node].begin = begin;
+  nodes[node].end = end;
+  nodes[node].parent = parent;
+  nodes[node].right_child = -1;
+  nodes[node].min_x = nodes[node].max_x = points[begin].x();
+  nodes[node].min_y = nodes[node].max_y = points[begin].y();
+  for (int i = begin + 1; i < end; ++i) {
+    nodes[node].min_x = (std::min)(nodes[node].min_x, points[i].x());
+    nodes[node].max_x = (std::max)(nodes[node].max_x, points[i].x());
+    nodes[node].min_y = (std::min)(nodes[node].min_y, points[i].y());
+    nodes[node].max_y = (std::max)(nodes[node].max_y, points[i].y());
+  }
+  if (end - begin <= max_leaf_size) {
+    for (int i = begin; i < end; ++i) leaf[points[i].point_index] = node;
+    update(node);
+    return node;
+  }
+  int middle = begin + (end - begin) / 2;
+  std::nth_element(points.begin() + begin, points.begin() + middle, points.begin() + end,
+                   [split_x](const Internal_point& p, const Internal_point& q) {
+                     return split_x ? p.x() < q.x() : p.y() < q.y();
+                   });
+  build(begin, middle, node, !split_x);
+  int right_child = build(middle, end, node, !split_x);
+  nodes[node].right_child = right_child;
+  update(node);
+  return node;
+}
+
+inline double Weighted_neighbors_finder::power(double distance) const {
+  if (order == 1.) return distance;
+  if (order == 2.) return distance * distance;
+  return std::pow(distance, order);
+}
+
+inline double Weighted_neighbors_finder::weight(int v_point_index) const {
+  return weights[v_point_index];
+}
+
+inline void Weighted_neighbors_finder::set_weight(int v_point_index, double weight) {
+  weights[v_point_index] = weight;
+  for (int node = leaf[v_point_index]; node != -1; node = nodes[node].parent) {
+    Node old = nodes[node];
+    update(node);
+    const Node& n = nodes[node];
+    if (n.min_weight == old.min_weight && n.min_weight_plus_x == old.min_weight_plus_x &&
+        n.min_weight_minus_x == old.min_weight_minus_x && n.min_weight_plus_y == old.min_weight_plus_y &&
+        n.min_weight_minus_y == old.min_weight_minus_y)
+      break;
+  }
+}
+
+inline void Weighted_neighbors_finder::update(int node) {
+  Node& n = nodes[node];
+  if (n.right_child == -1) {
+    n.min_weight = n.min_weight_plus_x = n.min_weight_minus_x = n.min_weight_plus_y = n.min_weight_minus_y =
+        std::numeric_limits<double>::infinity();
+    for (int i = n.begin; i < n.end; ++i) {
+      const Internal_point& q = points[i];
+      double w = weights[q.point_index];
+      n.min_weight = (std::min)(n.min_weight, w);
+      if (order != 1.) continue;
+      n.min_weight_plus_x = (std::min)(n.min_weight_plus_x, w + q.x());
+      n.min_weight_minus_x = (std::min)(n.min_weight_minus_x, w - q.x());
+      n.min_weight_plus_y = (std::min)(n.min_weight_plus_y, w + q.y());
+      n.min_weight_minus_y = (std::min)(n.min_weight_minus_y, w - q.y());
+    }
+  } else {
+    const Node& left = nodes[node + 1];
+    const Node& right = nodes[n.right_child];
+    n.min_weight = (std::min)(left.min_weight, right.min_weight);
+    if (order != 1.) return;
+    n.min_weight_plus_x = (std::min)(left.min_weight_plus_x, right.min_weight_plus_x);
+    n.min_weight_minus_x = (std::min)(left.min_weight_minus_x, right.min_weight_minus_x);
+    n.min_weight_plus_y = (std::min)(left.min_weight_plus_y, right.min_weight_plus_y);
+    n.min_weight_minus_y = (std::min)(left.min_weight_minus_y, right.min_weight_minus_y);
+  }
+}
+
+inline void Weighted_neighbors_finder::find_two_best(const Internal_point& p, Weighted_neighbor& best,
+                                                     Weighted_neighbor& second) const {
+  if (!nodes.empty()) search(0, p, best, second);
+}
+
+inline void Weighted_neighbors_finder::search(int node, const Internal_point& p, Weighted_neighbor& best,
+                                              Weighted_neighbor& second) const {
+  const Node& n = nodes[node];
+  if (n.right_child == -1) {
+    for (int i = n.begin; i < n.end; ++i) {
+      const Internal_point& q = points[i];
+      double value = power((std::max)(std::fabs(p.x() - q.x()), std::fabs(p.y() - q.y()))) +
+                     weights[q.point_index];
+      if (value < best.value) {
+        second = best;
+        best.v_point_index = q.point_index;
+        best.value = value;
+      } else if (value < second.value && q.point_index != best.v_point_index) {
+        // The initial best point may be found again.
+        second.v_point_index = q.point_index;
+        second.value = value;
+      }
+    }
+    return;
+  }
+  // Lower bounds of the values of the points of the children, the closest child is searched first.
+  auto lower_bound = [this, &p](const Node& child) {
+    double dx = (std::max)((std::max)(child.min_x - p.x(), p.x() - child.max_x), 0.);
+    double dy = (std::max)((std::max)(child.min_y - p.y(), p.y() - child.max_y), 0.);
+    double bound = power((std::max)(dx, dy)) + child.min_weight;
+    if (order != 1.) return bound;
+    // With order 1, the value of a point q is at least its weight plus or minus q.x() - p.x(), and the same for y.
+    double x_bound = (std::max)(child.min_weight_plus_x - p.x(), child.min_weight_minus_x + p.x());
+    double y_bound = (std::max)(child.min_weight_plus_y - p.y(), child.min_weight_minus_y + p.y());
+    return (std::max)(bound, (std::max)(x_bound, y_bound));
+  };
+  int first_child = node + 1;
+  int second_child = n.right_child;
+  double first_bound = lower_bound(nodes[first_child]);
+  double second_bound = lower_bound(nodes[second_child]);
+  if (second_bound < first_bound) {
+    std::swap(first_child, second_child);
+    std::swap(first_bound, second_bound);
+  }
+  if (first_bound < second.value) search(first_child, p, best, second);
+  if (second_bound < second.value) search(second_child, p, best, second);
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // WEIGHTED_NEIGHBORS_FINDER_H_
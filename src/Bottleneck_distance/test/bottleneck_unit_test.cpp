@@ -17,6 +17,7 @@
 
 #include <random>
 #include <gudhi/Bottleneck.h>
+#include <gudhi/Bottleneck_distance_matrix.h>
 
 using namespace Gudhi::persistence_diagram;
 
@@ -134,6 +135,102 @@ BOOST_AUTO_TEST_CASE(graph_matching) {
   BOOST_CHECK(!m1.perfect());
 }
 
+BOOST_AUTO_TEST_CASE(grid_neighbors_finder) {
+  Persistence_graph g(v1, v2, 0.);
+  Neighbors_grid grid(g, 1., Neighbors_grid());
+  Grid_neighbors_finder nf(g, grid);
+  for (int v_point_index = 1; v_point_index < ((n2 + n1)*9 / 10); v_point_index += 2)
+    nf.add(v_point_index);
+  //
+  int v_point_index_1 = nf.pull_near(n2 / 2);
+  BOOST_CHECK((v_point_index_1 == -1) || (g.distance(n2 / 2, v_point_index_1) <= 1.));
+  std::vector<int> l = nf.pull_all_near(n2 / 2);
+  bool v = true;
+  for (auto it = l.cbegin(); it != l.cend(); ++it)
+    v = v && (g.distance(n2 / 2, *it) <= 1.);
+  BOOST_CHECK(v);
+  int v_point_index_2 = nf.pull_near(n2 / 2);
+  BOOST_CHECK(v_point_index_2 == -1);
+  // The grid finds the same neighbors as the kd-tree.
+  for (double r : {0., 1., 10., 100., 1000.}) {
+    Neighbors_finder kd_nf(g, r);
+    Grid_neighbors_finder grid_nf(g, Neighbors_grid(g, r, grid));
+    for (int v_point_index = 0; v_point_index < g.size(); v_point_index += 3) {
+      kd_nf.add(v_point_index);
+      grid_nf.add(v_point_index);
+    }
+    for (int u_point_index = 0; u_point_index < g.size(); u_point_index += 7) {
+      std::vector<int> kd_l = kd_nf.pull_all_near(u_point_index);
+      std::vector<int> grid_l = grid_nf.pull_all_near(u_point_index);
+      std::sort(kd_l.begin(), kd_l.end());
+      std::sort(grid_l.begin(), grid_l.end());
+      BOOST_CHECK(kd_l == grid_l);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(layered_grid_neighbors_finder) {
+  Persistence_graph g(v1, v2, 0.);
+  Layered_grid_neighbors_finder lnf(g, Neighbors_grid(g, 1., Neighbors_grid()));
+  for (int v_point_index = 1; v_point_index < ((n2 + n1)*9 / 10); v_point_index += 2)
+    lnf.add(v_point_index, v_point_index % 7);
+  BOOST_CHECK(lnf.vlayers_number() == 7);
+  //
+  int v_point_index_1 = lnf.pull_near(n2 / 2, 6);
+  BOOST_CHECK((v_point_index_1 == -1) || (g.distance(n2 / 2, v_point_index_1) <= 1.));
+  int v_point_index_2 = lnf.pull_near(n2 / 2, 6);
+  BOOST_CHECK(v_point_index_2 == -1);
+  v_point_index_1 = lnf.pull_near(n2 / 2, 0);
+  BOOST_CHECK((v_point_index_1 == -1) || (g.distance(n2 / 2, v_point_index_1) <= 1.));
+  v_point_index_2 = lnf.pull_near(n2 / 2, 0);
+  BOOST_CHECK(v_point_index_2 == -1);
+  BOOST_CHECK(lnf.pull_near(n2 / 2, 7) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(graph_matching_options) {
+  // integer coordinates, to have many equal distances
+  std::uniform_int_distribution<int> unif_int(0, 50);
+  for (int n = 5; n <= 200; n *= 3) {
+    std::vector< std::pair<double, double> > w1, w2;
+    for (int i = 0; i < n; i++) {
+      int a = unif_int(re);
+      int b = unif_int(re);
+      w1.emplace_back(std::min(a, b), std::max(a, b) + 1);
+      a = unif_int(re);
+      b = unif_int(re);
+      w2.emplace_back(std::min(a, b), std::max(a, b) + 1);
+    }
+    w2.resize(n / 2);
+    Persistence_graph g(w1, w2, 0.);
+    double expected = bottleneck_distance_exact<Graph_matching_kd_tree_options>(g);
+    BOOST_CHECK(bottleneck_distance_exact<Graph_matching_grid_options>(g) == expected);
+    BOOST_CHECK(bottleneck_distance_exact_low_memory<Graph_matching_grid_options>(g) == expected);
+    BOOST_CHECK(bottleneck_distance_approx<Graph_matching_grid_options>(g, 0.01) <= expected + 0.01);
+    BOOST_CHECK(bottleneck_distance_approx<Graph_matching_grid_options>(g, 0.01) >= expected - 0.01);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(graph_matching_options_different_scales) {
+  // The points of U are far outside the grid built on the points of V, whose cells are tiny.
+  std::vector< std::pair<double, double> > w1 = {{0., 1e6}, {0., 1.0005}};
+  std::vector< std::pair<double, double> > w2 = {{0., 1.}, {0., 1.001}};
+  Persistence_graph g(w1, w2, 0.);
+  Neighbors_grid grid(g, 0., Neighbors_grid());
+  Grid_neighbors_finder nf(g, grid);
+  for (int v_point_index = 0; v_point_index < g.size(); ++v_point_index)
+    nf.add(v_point_index);
+  BOOST_CHECK(nf.pull_all_near(0).empty());
+  double expected = bottleneck_distance_exact<Graph_matching_kd_tree_options>(g);
+  BOOST_CHECK(expected == 5e5);
+  BOOST_CHECK(bottleneck_distance_exact<Graph_matching_grid_options>(g) == expected);
+  BOOST_CHECK(bottleneck_distance_exact_low_memory<Graph_matching_kd_tree_options>(g) == expected);
+  BOOST_CHECK(bottleneck_distance_exact_low_memory<Graph_matching_grid_options>(g) == expected);
+  BOOST_CHECK(bottleneck_distance_approx<Graph_matching_kd_tree_options>(g, 0.01) <= expected + 0.01);
+  BOOST_CHECK(bottleneck_distance_approx<Graph_matching_kd_tree_options>(g, 0.01) >= expected - 0.01);
+  BOOST_CHECK(bottleneck_distance_approx<Graph_matching_grid_options>(g, 0.01) <= expected + 0.01);
+  BOOST_CHECK(bottleneck_distance_approx<Graph_matching_grid_options>(g, 0.01) >= expected - 0.01);
+}
+
 BOOST_AUTO_TEST_CASE(global) {
   std::uniform_real_distribution<double> unif1(0., upper_bound);
   std::uniform_real_distribution<double> unif2(upper_bound / 10000., upper_bound / 100.);
@@ -155,3 +252,90 @@ BOOST_AUTO_TEST_CASE(global) {
   BOOST_CHECK(bottleneck_distance(v1, v2, upper_bound / 10000.) <= upper_bound / 100. + upper_bound / 10000.);
   BOOST_CHECK(std::abs(bottleneck_distance(v1, v2, 0.) - bottleneck_distance(v1, v2, upper_bound / 10000.)) <= upper_bound / 10000.);
 }
+
+BOOST_AUTO_TEST_CASE(persistence_graph_distances) {
+  // integer coordinates, to have many equal distances
+  std::uniform_int_distribution<int> unif_int(0, 20);
+  std::vector< std::pair<double, double> > w1, w2;
+  for (int i = 0; i < 30; i++) {
+    int a = unif_int(re);
+    int b = unif_int(re);
+    w1.emplace_back(std::min(a, b), std::max(a, b) + 1);
+  }
+  for (int i = 0; i < 20; i++) {
+    int a = unif_int(re);
+    int b = unif_int(re);
+    w2.emplace_back(std::min(a, b), std::max(a, b) + 1);
+  }
+  Persistence_graph g(w1, w2, 0.);
+  Persistence_graph_distances distances(g);
+  std::vector<double> d(g.sorted_distances());
+  BOOST_CHECK(distances.upper_bound() >= d.back());
+  for (double r = -1.; r <= 22.; r += 0.5) {
+    std::size_t count = 0;
+    for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
+      for (int v_point_index = 0; v_point_index < g.size(); ++v_point_index)
+        if (g.distance(u_point_index, v_point_index) <= r)
+          ++count;
+    BOOST_CHECK(distances.count(r) == count);
+  }
+  d.erase(std::unique(d.begin(), d.end()), d.end());
+  for (double lower : {-1., 0., 2.5, 7.}) {
+    for (double upper : {0., 3., 7., 30.}) {
+      std::vector<double> expected;
+      for (double distance : d)
+        if (lower < distance && distance <= upper)
+          expected.push_back(distance);
+      BOOST_CHECK(distances.sorted_distances(lower, upper) == expected);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(exact_low_memory) {
+  std::vector< std::pair<double, double> > empty;
+  Persistence_graph g_empty(empty, empty, 0.);
+  BOOST_CHECK(bottleneck_distance_exact_low_memory(g_empty) == 0.);
+  Persistence_graph g(v1, v2, 0.);
+  BOOST_CHECK(bottleneck_distance_exact_low_memory(g) == bottleneck_distance_exact(g));
+  Persistence_graph g_reversed(v2, v1, 0.);
+  BOOST_CHECK(bottleneck_distance_exact_low_memory(g_reversed) == bottleneck_distance_exact(g_reversed));
+}
+
+BOOST_AUTO_TEST_CASE(distance_matrix) {
+  std::uniform_real_distribution<double> unif1(0., upper_bound);
+  std::default_random_engine re;
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector< std::vector< std::pair<double, double> > > diagrams(6);
+  for (std::size_t k = 0; k < diagrams.size(); k++) {
+    for (int i = 0; i < 20 + 10 * static_cast<int>(k); i++) {
+      double a = unif1(re);
+      double b = unif1(re);
+      diagrams[k].emplace_back(std::min(a, b), std::max(a, b));
+    }
+    // the last diagram has one more essential class than the others
+    for (std::size_t i = 0; i < 2 + k / 5; i++)
+      diagrams[k].emplace_back(unif1(re), inf);
+  }
+  for (double e : {0., upper_bound / 10000.}) {
+    std::vector<double> condensed = condensed_bottleneck_distance_matrix(diagrams, e);
+    std::vector< std::vector<double> > matrix = bottleneck_distance_matrix(diagrams, e);
+    BOOST_CHECK(condensed.size() == diagrams.size() * (diagrams.size() - 1) / 2);
+    BOOST_CHECK(matrix.size() == diagrams.size());
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < diagrams.size(); i++) {
+      BOOST_CHECK(matrix[i][i] == 0.);
+      std::vector<double> distances = bottleneck_distances(diagrams[i], diagrams, e);
+      for (std::size_t j = 0; j < diagrams.size(); j++) {
+        double expected = bottleneck_distance(diagrams[i], diagrams[j], e);
+        BOOST_CHECK(distances[j] == expected);
+        // the approximate distance between a diagram and itself is not always 0
+        if (i != j) BOOST_CHECK(matrix[i][j] == expected);
+        if (i < j) BOOST_CHECK(condensed[index++] == expected);
+      }
+    }
+    BOOST_CHECK(matrix[0][5] == inf);
+  }
+  std::vector< std::vector< std::pair<double, double> > > one_diagram(1, diagrams[0]);
+  BOOST_CHECK(condensed_bottleneck_distance_matrix(one_diagram).empty());
+  BOOST_CHECK(bottleneck_distance_matrix(one_diagram) == std::vector< std::vector<double> >(1, std::vector<double>(1, 0.)));
+}
@@ -0,0 +1,122 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "wasserstein distance"
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::next_permutation
+#include <numeric>  // for std::iota
+#include <limits>  // for std::numeric_limits
+#include <cmath>  // for std::pow
+#include <stdexcept>  // for std::invalid_argument
+#include <gudhi/Wasserstein.h>
+
+using namespace Gudhi::persistence_diagram;
+
+typedef std::vector< std::pair<double, double> > Diagram;
+
+// Minimal cost of a perfect matching in the graph, where each point can be matched with any projection.
+double brute_force_wasserstein_distance(const Diagram& diag1, const Diagram& diag2, double order) {
+  Persistence_graph g(diag1, diag2, 0.);
+  std::vector<int> matching(g.size());
+  std::iota(matching.begin(), matching.end(), 0);
+  double result = std::numeric_limits<double>::infinity();
+  do {
+    double cost = 0.;
+    for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
+      cost += std::pow(g.distance(u_point_index, matching[u_point_index]), order);
+    result = std::min(result, cost);
+  } while (std::next_permutation(matching.begin(), matching.end()));
+  return std::pow(result, 1. / order);
+}
+
+Diagram random_diagram(std::default_random_engine& re, int n) {
+  // integer coordinates, to have many equal distances
+  std::uniform_int_distribution<int> unif(0, 20);
+  Diagram diag;
+  for (int i = 0; i < n; i++) {
+    int a = unif(re);
+    int b = unif(re);
+    diag.emplace_back(std::min(a, b), std::max(a, b) + 1);
+  }
+  return diag;
+}
+
+BOOST_AUTO_TEST_CASE(simple_diagrams) {
+  Diagram empty;
+  Diagram diag1 {{0., 2.}, {1., 5.}};
+  Diagram diag2 {{0., 3.}};
+  BOOST_CHECK(wasserstein_distance(empty, empty) == 0.);
+  BOOST_CHECK(wasserstein_distance(diag1, diag1, 1., 0.) == 0.);
+  // (1, 5) is at distance 2 from the diagonal
+  BOOST_CHECK(wasserstein_distance(diag1, empty, 1., 0.) == 3.);
+  BOOST_CHECK(wasserstein_distance(diag1, empty, 2., 0.) == std::sqrt(5.));
+  // (0, 3) is matched with (0, 2), and (1, 5) with the diagonal
+  BOOST_CHECK(wasserstein_distance(diag1, diag2, 1., 0.) == 3.);
+  BOOST_CHECK(wasserstein_distance(diag2, diag1, 1., 0.) == 3.);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_arguments) {
+  Diagram diag {{0., 2.}};
+  BOOST_CHECK_THROW(wasserstein_distance(diag, diag, 0.5), std::invalid_argument);
+  BOOST_CHECK_THROW(wasserstein_distance(diag, diag, 1., -0.1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(essential_classes) {
+  const double inf = std::numeric_limits<double>::infinity();
+  Diagram diag1 {{0., inf}, {3., inf}, {1., 2.}};
+  Diagram diag2 {{4., inf}, {1., inf}};
+  Diagram diag3 {{1., inf}};
+  // the essential classes are matched by birth: 0 with 1 and 3 with 4
+  BOOST_CHECK(wasserstein_distance(diag1, diag2, 1., 0.) == 2.5);
+  BOOST_CHECK(wasserstein_distance(diag1, diag3) == inf);
+}
+
+BOOST_AUTO_TEST_CASE(small_diagrams) {
+  std::default_random_engine re;
+  for (int n1 = 0; n1 <= 4; n1++) {
+    for (int n2 = 0; n2 <= 4; n2++) {
+      Diagram diag1 = random_diagram(re, n1);
+      Diagram diag2 = random_diagram(re, n2);
+      for (double order : {1., 2., 3.5}) {
+        double expected = brute_force_wasserstein_distance(diag1, diag2, order);
+        double exact = wasserstein_distance(diag1, diag2, order, 0.);
+        BOOST_CHECK_CLOSE(exact, expected, 1e-10);
+        double approximate = wasserstein_distance(diag1, diag2, order, 0.1);
+        BOOST_CHECK(approximate >= expected * (1. - 1e-10));
+        BOOST_CHECK(approximate <= expected * 1.1 * (1. + 1e-10));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(large_diagrams) {
+  std::default_random_engine re;
+  std::uniform_real_distribution<double> unif1(0., 100.);
+  std::uniform_real_distribution<double> unif2(0.1, 1.);
+  Diagram diag1, diag2;
+  for (int i = 0; i < 500; i++) {
+    double a = unif1(re);
+    double b = unif1(re);
+    diag1.emplace_back(std::min(a, b), std::max(a, b));
+    diag2.emplace_back(std::min(a, b) + unif2(re), std::max(a, b) + unif2(re));
+    if (i % 5 == 0)
+      diag1.emplace_back(a, a + unif2(re));
+  }
+  for (double order : {1., 2.}) {
+    double exact = wasserstein_distance(diag1, diag2, order, 0.);
+    for (double delta : {0.01, 0.1}) {
+      double approximate = wasserstein_distance(diag1, diag2, order, delta);
+      BOOST_CHECK(approximate >= exact * (1. - 1e-10));
+      BOOST_CHECK(approximate <= exact * (1. + delta) * (1. + 1e-10));
+    }
+  }
+}
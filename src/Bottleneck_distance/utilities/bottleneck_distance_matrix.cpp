@@ -0,0 +1,102 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Bottleneck_distance_matrix.h>
+#include <gudhi/reader_utils.h>
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <utility>  // for pair
+#include <string>
+#include <limits>  // for numeric_limits
+#include <cstdlib>  // for exit
+
+using Persistence_diagram = std::vector<std::pair<double, double>>;
+
+void program_options(int argc, char* argv[], std::vector<std::string>& diagram_files, std::string& csv_matrix_file,
+                     int& dimension, double& tolerance);
+
+void write_lower_triangular_matrix(std::ostream& out, const std::vector<std::vector<double>>& matrix) {
+  out.precision(std::numeric_limits<double>::max_digits10);
+  // The first line is empty, as in read_lower_triangular_matrix_from_csv_file.
+  out << std::endl;
+  for (std::size_t i = 1; i < matrix.size(); ++i) {
+    for (std::size_t j = 0; j < i; ++j) out << matrix[i][j] << ";";
+    out << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::vector<std::string> diagram_files;
+  std::string csv_matrix_file;
+  int dimension;
+  double tolerance;
+
+  program_options(argc, argv, diagram_files, csv_matrix_file, dimension, tolerance);
+
+  std::vector<Persistence_diagram> diagrams;
+  for (const std::string& diagram_file : diagram_files)
+    diagrams.push_back(Gudhi::read_persistence_intervals_in_dimension(diagram_file, dimension));
+
+  std::vector<std::vector<double>> matrix =
+      Gudhi::persistence_diagram::bottleneck_distance_matrix(diagrams, tolerance);
+
+  if (csv_matrix_file.empty()) {
+    write_lower_triangular_matrix(std::cout, matrix);
+  } else {
+    std::ofstream out(csv_matrix_file);
+    write_lower_triangular_matrix(out, matrix);
+    out.close();
+  }
+  return 0;
+}
+
+void program_options(int argc, char* argv[], std::vector<std::string>& diagram_files, std::string& csv_matrix_file,
+                     int& dimension, double& tolerance) {
+  namespace po = boost::program_options;
+  po::options_description hidden("Hidden options");
+  hidden.add_options()(
+      "input-files", po::value<std::vector<std::string>>(&diagram_files),
+      "Names of the files containing the persistence diagrams.");
+
+  po::options_description visible("Allowed options", 100);
+  visible.add_options()("help,h", "produce help message")(
+      "output-file,o", po::value<std::string>(&csv_matrix_file)->default_value(std::string()),
+      "Name of file in which the distance matrix is written. Default print in std::cout")(
+      "dimension,d", po::value<int>(&dimension)->default_value(-1),
+      "Dimension of the intervals that are read in the files. Default is all the intervals.")(
+      "tolerance,e", po::value<double>(&tolerance)->default_value((std::numeric_limits<double>::min)()),
+      "Error bound on the bottleneck distances. Default is the smallest positive double value. If you set the error "
+      "bound to 0, be aware this version is exact but expensive.");
+
+  po::positional_options_description pos;
+  pos.add("input-files", -1);
+
+  po::options_description all;
+  all.add(visible).add(hidden);
+
+  po::variables_map vm;
+  po::store(po::command_line_parser(argc, argv).options(all).positional(pos).run(), vm);
+  po::notify(vm);
+
+  if (vm.count("help") || diagram_files.size() < 2) {
+    std::cout << std::endl;
+    std::cout << "Compute the bottleneck distances between all the pairs of persistence diagrams \n";
+    std::cout << "given in the input files, in the format described in the file formats documentation.\n \n";
+    std::cout << "The output is the lower triangular distance matrix, with ';' as separator, \n";
+    std::cout << "in the format of the Rips complex utilities. The distance between two diagrams \n";
+    std::cout << "that do not have the same number of essential classes is inf." << std::endl << std::endl;
+
+    std::cout << "Usage: " << argv[0] << " [options] input-file-1 input-file-2 [input-file-3 ...]" << std::endl
+              << std::endl;
+    std::cout << visible << std::endl;
+    exit(-1);
+  }
+}
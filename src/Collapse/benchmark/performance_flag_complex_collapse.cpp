@@ -0,0 +1,106 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Rips_complex.h>
+#include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Points_off_io.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort
+#include <cstdlib>  // for std::atof, std::atoi
+
+// Types definition
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
+using Point = std::vector<double>;
+using Points_off_reader = Gudhi::Points_off_reader<Point>;
+using Diagram = std::vector<std::vector<std::pair<Filtration_value, Filtration_value>>>;
+
+/* Computes the persistence diagram of st in Z/pZ up to dimension dim_max - 1, and returns it sorted. */
+Diagram timing_persistence(Simplex_tree& st, int dim_max, int p) {
+  Gudhi::Clock clock("  Compute persistence");
+  Persistent_cohomology pcoh(st);
+  pcoh.init_coefficients(p);
+  pcoh.compute_persistent_cohomology();
+  Diagram diagram;
+  for (int dim = 0; dim < dim_max; ++dim) {
+    diagram.push_back(pcoh.intervals_in_dimension(dim));
+    std::sort(diagram.back().begin(), diagram.back().end());
+  }
+  std::cout << clock;
+  return diagram;
+}
+
+/* Compares the computation of the persistence of a Rips complex, with and without collapsing the edges of the Rips
+ * graph before the expansion.
+ * Default values are the ones of performance_rips_persistence (Klein bottle sampling embedded in dimension 5).
+ * Usage: performance_flag_complex_collapse [off_file [threshold [dim_max [p]]]] */
+int main(int argc, char * argv[]) {
+  std::string off_file_points = "Kl.off";
+  Filtration_value threshold = 0.27;
+  int dim_max = 3;
+  int p = 2;
+  if (argc > 1) off_file_points = argv[1];
+  if (argc > 2) threshold = std::atof(argv[2]);
+  if (argc > 3) dim_max = std::atoi(argv[3]);
+  if (argc > 4) p = std::atoi(argv[4]);
+
+  Points_off_reader off_reader(off_file_points);
+  Gudhi::Clock clock("Compute the Rips graph");
+  Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+  std::cout << clock;
+  std::cout << "  - number of edges     = " << boost::num_edges(rips_complex_from_file.one_skeleton_graph())
+      << std::endl;
+
+  Diagram diagram;
+  double total = 0.;
+  {
+    std::cout << "Without edge collapse:\n";
+    Gudhi::Clock total_clock;
+    Simplex_tree st;
+    clock.begin();
+    rips_complex_from_file.create_complex(st, dim_max);
+    clock.end();
+    std::cout << "  Insert the graph and expand it in " << clock.num_seconds() << " s\n";
+    std::cout << "  - number of simplices = " << st.num_simplices() << std::endl;
+    diagram = timing_persistence(st, dim_max, p);
+    total = total_clock.num_seconds();
+    std::cout << "  Total: " << total << " s\n";
+  }
+  {
+    std::cout << "With edge collapse:\n";
+    Gudhi::Clock total_clock;
+    clock.begin();
+    auto collapsed_graph = Gudhi::collapse::flag_complex_collapse_graph(rips_complex_from_file.one_skeleton_graph());
+    clock.end();
+    std::cout << "  Collapse the edges in " << clock.num_seconds() << " s\n";
+    std::cout << "  - number of edges     = " << boost::num_edges(collapsed_graph) << std::endl;
+    Simplex_tree st;
+    clock.begin();
+    st.insert_graph(collapsed_graph);
+    st.expansion(dim_max);
+    clock.end();
+    std::cout << "  Insert the graph and expand it in " << clock.num_seconds() << " s\n";
+    std::cout << "  - number of simplices = " << st.num_simplices() << std::endl;
+    Diagram collapsed_diagram = timing_persistence(st, dim_max, p);
+    double collapsed_total = total_clock.num_seconds();
+    std::cout << "  Total: " << collapsed_total << " s - speedup " << total / collapsed_total << std::endl;
+    if (collapsed_diagram != diagram)
+      std::cout << "Error: the persistence diagrams differ" << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,269 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef FLAG_COMPLEX_EDGE_COLLAPSER_H_
+#define FLAG_COMPLEX_EDGE_COLLAPSER_H_
+
+#include <gudhi/graph_simplicial_complex.h>  // for vertex_filtration_t, edge_filtration_t
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/range/iterator_range.hpp>  // for boost::make_iterator_range
+
+#include <vector>
+#include <tuple>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort, std::lower_bound, std::inplace_merge
+#include <iterator>  // for std::begin
+#include <type_traits>  // for std::decay
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace collapse {
+
+/**
+ * \class Flag_complex_edge_collapser
+ * \brief Edge collapse of the 1-skeleton of a filtered flag complex.
+ *
+ * \ingroup collapse
+ *
+ * \details
+ * The edges are processed by decreasing filtration value. An edge \f$uv\f$ is dominated by a vertex \f$w\f$ at
+ * time \f$t\f$ when the closed neighborhood of \f$w\f$ contains all the common neighbors of \f$u\f$ and \f$v\f$ at
+ * time \f$t\f$. A dominated edge is delayed as long as it remains dominated, by \f$w\f$ or by another vertex, and
+ * removed if it remains dominated until the end of the filtration. The flag complex of the resulting graph has the
+ * same persistence diagram as the flag complex of the input graph.
+ *
+ * \tparam Vertex must be an integer type. Vertices are numbered from 0 to `num_vertices - 1`.
+ * \tparam Filtration_value is the type of the filtration values of the edges.
+ */
+template<typename Vertex, typename Filtration_value>
+class Flag_complex_edge_collapser {
+ public:
+  /** \brief Type of a filtered edge: its two vertices and its filtration value. */
+  typedef std::tuple<Vertex, Vertex, Filtration_value> Filtered_edge;
+
+  /** \brief Collapses the edges of a filtered graph.
+   *
+   * @param[in] edges Range of filtered edges, each of them without duplicate nor self-loop.
+   *
+   * \tparam FilteredEdgeRange must be a range for which `std::begin` and `std::end` return input iterators on an
+   * element `e` such that `std::get<0>(e)`, `std::get<1>(e)` and `std::get<2>(e)` return the two vertices and the
+   * filtration value of an edge, like `Filtered_edge`.
+   */
+  template<typename FilteredEdgeRange>
+  explicit Flag_complex_edge_collapser(const FilteredEdgeRange& edges) {
+    std::vector<Filtered_edge> sorted_edges;
+    std::size_t num_vertices = 0;
+    for (auto&& edge : edges) {
+      Vertex u = std::get<0>(edge);
+      Vertex v = std::get<1>(edge);
+      sorted_edges.emplace_back(u, v, std::get<2>(edge));
+      num_vertices = (std::max)(num_vertices, static_cast<std::size_t>((std::max)(u, v)) + 1);
+    }
+    neighbors_.resize(num_vertices);
+    for (auto& edge : sorted_edges) {
+      neighbors_[std::get<0>(edge)].emplace_back(std::get<1>(edge), std::get<2>(edge));
+      neighbors_[std::get<1>(edge)].emplace_back(std::get<0>(edge), std::get<2>(edge));
+    }
+    for (auto& neighbor_list : neighbors_)
+      std::sort(neighbor_list.begin(), neighbor_list.end());
+    // The order between edges with the same filtration value does not matter, but must be a total order.
+    std::stable_sort(sorted_edges.begin(), sorted_edges.end(), [](const Filtered_edge& a, const Filtered_edge& b) {
+      return std::get<2>(a) > std::get<2>(b);
+    });
+
+    for (auto& edge : sorted_edges) {
+      Vertex u = std::get<0>(edge);
+      Vertex v = std::get<1>(edge);
+      Filtration_value filtration = std::get<2>(edge);
+      if (collapse_edge(u, v, filtration)) {
+        erase_neighbor(u, v);
+        erase_neighbor(v, u);
+      } else {
+        if (filtration != std::get<2>(edge)) {
+          find_neighbor(u, v)->second = filtration;
+          find_neighbor(v, u)->second = filtration;
+        }
+        collapsed_edges_.emplace_back(u, v, filtration);
+      }
+    }
+    std::reverse(collapsed_edges_.begin(), collapsed_edges_.end());
+    // Delayed edges may have moved past edges that were processed before them.
+    std::stable_sort(collapsed_edges_.begin(), collapsed_edges_.end(),
+                     [](const Filtered_edge& a, const Filtered_edge& b) {
+      return std::get<2>(a) < std::get<2>(b);
+    });
+  }
+
+  /** \brief Returns the remaining edges, with their possibly increased filtration values, sorted by increasing
+   * filtration value.
+   */
+  const std::vector<Filtered_edge>& collapsed_edges() const {
+    return collapsed_edges_;
+  }
+
+ private:
+  // Neighbor of a vertex, with the current filtration value of the edge between them.
+  typedef std::pair<Vertex, Filtration_value> Neighbor;
+
+  static bool vertex_less(const Neighbor& neighbor, Vertex v) {
+    return neighbor.first < v;
+  }
+
+  typename std::vector<Neighbor>::iterator find_neighbor(Vertex u, Vertex v) {
+    return std::lower_bound(neighbors_[u].begin(), neighbors_[u].end(), v, vertex_less);
+  }
+
+  void erase_neighbor(Vertex u, Vertex v) {
+    neighbors_[u].erase(find_neighbor(u, v));
+  }
+
+  // Whether the edge dw exists at time t.
+  bool is_edge(Vertex d, Vertex w, Filtration_value t) {
+    auto it = find_neighbor(d, w);
+    return it != neighbors_[d].end() && it->first == w && !(it->second > t);
+  }
+
+  // Whether all the common neighbors in present_, except d itself, are neighbors of d at time t.
+  bool dominates(Vertex d, Filtration_value t) const {
+    auto it = neighbors_[d].begin();
+    auto end = neighbors_[d].end();
+    for (Vertex w : present_) {
+      if (w == d) continue;
+      it = std::lower_bound(it, end, w, vertex_less);
+      if (it == end || it->first != w || it->second > t) return false;
+    }
+    return true;
+  }
+
+  // Splits the common neighbors of u and v between those present at time t, sorted by vertex, and the later
+  // ones, sorted by the time they appear.
+  void common_neighbors(Vertex u, Vertex v, Filtration_value t) {
+    present_.clear();
+    later_.clear();
+    auto ui = neighbors_[u].begin();
+    auto ue = neighbors_[u].end();
+    auto vi = neighbors_[v].begin();
+    auto ve = neighbors_[v].end();
+    while (ui != ue && vi != ve) {
+      if (ui->first < vi->first) {
+        ++ui;
+      } else if (vi->first < ui->first) {
+        ++vi;
+      } else {
+        Filtration_value f = (std::max)(ui->second, vi->second);
+        if (f > t)
+          later_.emplace_back(f, ui->first);
+        else
+          present_.push_back(ui->first);
+        ++ui;
+        ++vi;
+      }
+    }
+    std::sort(later_.begin(), later_.end());
+  }
+
+  // Delays the edge uv as long as it is dominated. Returns true if the edge can be removed, otherwise t is updated
+  // to the new filtration value of the edge.
+  bool collapse_edge(Vertex u, Vertex v, Filtration_value& t) {
+    common_neighbors(u, v, t);
+    auto next = later_.begin();
+    bool dominated = false;
+    Vertex dominator = Vertex();
+    while (true) {
+      if (!dominated) {
+        for (Vertex d : present_) {
+          if (dominates(d, t)) {
+            dominator = d;
+            dominated = true;
+            break;
+          }
+        }
+        if (!dominated) return false;
+      }
+      // The edge is dominated until the next common neighbor appears.
+      if (next == later_.end()) return true;
+      t = next->first;
+      std::size_t old_size = present_.size();
+      for (; next != later_.end() && !(next->first > t); ++next) {
+        present_.push_back(next->second);
+        if (dominated && !is_edge(dominator, next->second, t))
+          dominated = false;
+      }
+      std::inplace_merge(present_.begin(), present_.begin() + old_size, present_.end());
+    }
+  }
+
+  std::vector<std::vector<Neighbor>> neighbors_;
+  std::vector<Vertex> present_;
+  std::vector<std::pair<Filtration_value, Vertex>> later_;
+  std::vector<Filtered_edge> collapsed_edges_;
+};
+
+/** \brief Collapses the edges of a filtered graph, so that the flag complex of the result has the same persistence
+ * diagram as the flag complex of the input, and returns the remaining filtered edges.
+ *
+ * \ingroup collapse
+ *
+ * @param[in] edges Range of filtered edges, each of them without duplicate nor self-loop.
+ * @return The remaining edges, as `std::tuple<Vertex, Vertex, Filtration_value>`, sorted by increasing filtration
+ * value. Their filtration values may be larger than in the input.
+ *
+ * \tparam FilteredEdgeRange see `Flag_complex_edge_collapser`. Vertices must be non-negative integers.
+ */
+template<typename FilteredEdgeRange>
+std::vector<std::tuple<typename std::decay<decltype(std::get<0>(*std::begin(std::declval<FilteredEdgeRange&>())))>::type,
+                       typename std::decay<decltype(std::get<0>(*std::begin(std::declval<FilteredEdgeRange&>())))>::type,
+                       typename std::decay<decltype(std::get<2>(*std::begin(std::declval<FilteredEdgeRange&>())))>::type>>
+flag_complex_collapse_edges(const FilteredEdgeRange& edges) {
+  typedef typename std::decay<decltype(std::get<0>(*std::begin(edges)))>::type Vertex;
+  typedef typename std::decay<decltype(std::get<2>(*std::begin(edges)))>::type Filtration_value;
+  return Flag_complex_edge_collapser<Vertex, Filtration_value>(edges).collapsed_edges();
+}
+
+/** \brief Collapses the edges of a one skeleton graph, like the ones of `Gudhi::rips_complex::Rips_complex` and
+ * `Gudhi::rips_complex::Sparse_rips_complex`, and returns a new graph with the same vertices and the remaining
+ * edges.
+ *
+ * \ingroup collapse
+ *
+ * The result is meant to be given to `Simplex_tree::insert_graph()` before `Simplex_tree::expansion()`: the flag
+ * complex of the result has the same persistence diagram as the flag complex of the input.
+ *
+ * \tparam OneSkeletonGraph must be a model of
+ * <a href="https://www.boost.org/doc/libs/release/libs/graph/doc/VertexAndEdgeListGraph.html">boost::VertexAndEdgeListGraph</a>
+ * and <a href="https://www.boost.org/doc/libs/release/libs/graph/doc/MutablePropertyGraph.html">boost::MutablePropertyGraph</a>,
+ * with vertices numbered from 0, and internal properties `vertex_filtration_t` and `edge_filtration_t`, like the
+ * graphs accepted by `Simplex_tree::insert_graph()`.
+ */
+template<typename OneSkeletonGraph>
+OneSkeletonGraph flag_complex_collapse_graph(const OneSkeletonGraph& graph) {
+  typedef typename boost::graph_traits<OneSkeletonGraph>::vertex_descriptor Vertex;
+  typedef typename boost::property_traits<typename boost::property_map<OneSkeletonGraph,
+                                                                       edge_filtration_t>::const_type>::value_type
+      Filtration_value;
+  std::vector<std::tuple<Vertex, Vertex, Filtration_value>> edges;
+  for (auto edge : boost::make_iterator_range(boost::edges(graph)))
+    edges.emplace_back(boost::source(edge, graph), boost::target(edge, graph),
+                       boost::get(edge_filtration_t(), graph, edge));
+
+  OneSkeletonGraph collapsed(boost::num_vertices(graph));
+  for (auto vertex : boost::make_iterator_range(boost::vertices(graph)))
+    boost::put(vertex_filtration_t(), collapsed, vertex, boost::get(vertex_filtration_t(), graph, vertex));
+  Flag_complex_edge_collapser<Vertex, Filtration_value> collapser(edges);
+  for (auto& edge : collapser.collapsed_edges())
+    boost::add_edge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge), collapsed);
+  return collapsed;
+}
+
+}  // namespace collapse
+
+}  // namespace Gudhi
+
+#endif  // FLAG_COMPLEX_EDGE_COLLAPSER_H_
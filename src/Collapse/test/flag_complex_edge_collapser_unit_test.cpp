@@ -0,0 +1,128 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "flag_complex_edge_collapser"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/Sparse_rips_complex.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/distance_functions.h>
+
+#include <vector>
+#include <tuple>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort
+#include <random>
+
+using Simplex_tree = Gudhi::Simplex_tree<>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Filtered_edge = std::tuple<int, int, Filtration_value>;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Sparse_rips_complex = Gudhi::rips_complex::Sparse_rips_complex<Filtration_value>;
+using Diagram = std::vector<std::vector<std::pair<Filtration_value, Filtration_value>>>;
+
+// The collapsed complex may have a smaller dimension, so the diagrams are compared up to dim_max.
+Diagram sorted_diagram(Simplex_tree& st, int dim_max) {
+  Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Gudhi::persistent_cohomology::Field_Zp> pcoh(st);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Diagram diagram;
+  for (int dim = 0; dim < dim_max; ++dim) {
+    diagram.push_back(pcoh.intervals_in_dimension(dim));
+    std::sort(diagram.back().begin(), diagram.back().end());
+  }
+  return diagram;
+}
+
+Diagram flag_complex_diagram(int num_vertices, const std::vector<Filtered_edge>& edges, int dim_max) {
+  Simplex_tree st;
+  for (int v = 0; v < num_vertices; ++v)
+    st.insert_simplex({v}, 0.);
+  for (auto& edge : edges)
+    st.insert_simplex({std::get<0>(edge), std::get<1>(edge)}, std::get<2>(edge));
+  st.expansion(dim_max);
+  return sorted_diagram(st, dim_max);
+}
+
+BOOST_AUTO_TEST_CASE(collapse_complete_graph) {
+  std::vector<Filtered_edge> edges;
+  for (int u = 0; u < 6; ++u)
+    for (int v = u + 1; v < 6; ++v)
+      edges.emplace_back(u, v, 1.);
+  auto collapsed = Gudhi::collapse::flag_complex_collapse_edges(edges);
+  std::clog << "Complete graph on 6 vertices collapsed from " << edges.size() << " to " << collapsed.size()
+            << " edges\n";
+  // A contractible flag complex whose edges appear at the same time is collapsed to a tree.
+  BOOST_CHECK(collapsed.size() == 5);
+  for (auto& edge : collapsed)
+    BOOST_CHECK(std::get<2>(edge) == 1.);
+  BOOST_CHECK(flag_complex_diagram(6, collapsed, 5) == flag_complex_diagram(6, edges, 5));
+}
+
+BOOST_AUTO_TEST_CASE(collapse_keeps_cycles) {
+  // A square whose diagonal appears later: the cycle lives in [1, 2).
+  std::vector<Filtered_edge> edges = {Filtered_edge(0, 1, 1.), Filtered_edge(1, 2, 1.), Filtered_edge(2, 3, 1.),
+                                      Filtered_edge(0, 3, 1.), Filtered_edge(0, 2, 2.), Filtered_edge(1, 3, 3.)};
+  auto collapsed = Gudhi::collapse::flag_complex_collapse_edges(edges);
+  // The second diagonal is dominated by 0 (or by 2) when it appears, and remains so: it is removed.
+  BOOST_CHECK(collapsed.size() < edges.size());
+  auto diagram = flag_complex_diagram(4, collapsed, 3);
+  BOOST_CHECK(diagram == flag_complex_diagram(4, edges, 3));
+  BOOST_CHECK(diagram[1].size() == 1);
+  BOOST_CHECK(diagram[1][0] == std::make_pair(1., 2.));
+  // Sorted by increasing filtration value
+  for (std::size_t i = 1; i < collapsed.size(); ++i)
+    BOOST_CHECK(std::get<2>(collapsed[i - 1]) <= std::get<2>(collapsed[i]));
+}
+
+BOOST_AUTO_TEST_CASE(collapse_rips_graph) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::vector<double>> points(80, std::vector<double>(3));
+  for (auto& point : points)
+    for (auto& x : point) x = coord(gen);
+
+  for (int dim_max : {2, 3}) {
+    Rips_complex rips(points, 0.45, Gudhi::Euclidean_distance());
+    Simplex_tree st;
+    rips.create_complex(st, dim_max);
+
+    Simplex_tree collapsed_st;
+    collapsed_st.insert_graph(Gudhi::collapse::flag_complex_collapse_graph(rips.one_skeleton_graph()));
+    collapsed_st.expansion(dim_max);
+
+    std::clog << "Rips complex of dimension " << dim_max << ": " << st.num_simplices() << " simplices, "
+              << collapsed_st.num_simplices() << " after edge collapse\n";
+    BOOST_CHECK(collapsed_st.num_vertices() == st.num_vertices());
+    BOOST_CHECK(collapsed_st.num_simplices() < st.num_simplices());
+    BOOST_CHECK(sorted_diagram(collapsed_st, dim_max) == sorted_diagram(st, dim_max));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(collapse_sparse_rips_graph) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<std::vector<double>> points(60, std::vector<double>(2));
+  for (auto& point : points)
+    for (auto& x : point) x = coord(gen);
+
+  // With epsilon >= 1, the sparse Rips complex is the flag complex of its graph.
+  Sparse_rips_complex sparse_rips(points, Gudhi::Euclidean_distance(), 1.);
+  Simplex_tree st;
+  sparse_rips.create_complex(st, 3);
+
+  Simplex_tree collapsed_st;
+  collapsed_st.insert_graph(Gudhi::collapse::flag_complex_collapse_graph(sparse_rips.one_skeleton_graph()));
+  collapsed_st.expansion(3);
+
+  BOOST_CHECK(collapsed_st.num_simplices() <= st.num_simplices());
+  BOOST_CHECK(sorted_diagram(collapsed_st, 3) == sorted_diagram(st, 3));
+}
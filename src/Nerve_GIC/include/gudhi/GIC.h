@@ -26,7 +26,7 @@
 #include <gudhi/Points_off_io.h>
 #include <gudhi/distance_functions.h>
 #include <gudhi/Persistent_cohomology.h>
-#include <gudhi/Bottleneck.h>
+#include <gudhi/Bottleneck_distance_matrix.h>
 
 #include <boost/config.hpp>
 #include <boost/graph/graph_traits.hpp>
@@ -1215,8 +1215,10 @@ class Cover_complex {
     if (sz >= N) {
       std::cout << "Already done!" << std::endl;
     } else {
+      // The bootstrapped diagrams are computed first, so that their distances to PD are computed together.
+      std::vector<Persistence_diagram> boot_PDs;
       for (unsigned int i = 0; i < N - sz; i++) {
-        if (verbose)  std::cout << "Computing " << i << "th bootstrap, bottleneck distance = ";
+        if (verbose)  std::cout << "Computing " << i << "th bootstrap" << std::endl;
 
         Cover_complex Cboot; Cboot.n = this->n; Cboot.data_dimension = this->data_dimension; Cboot.type = this->type; Cboot.functional_cover = true;
 
@@ -1241,9 +1243,13 @@ class Cover_complex {
         Cboot.set_cover_from_function();
         Cboot.find_simplices();
         Cboot.compute_PD();
-        double db = Gudhi::persistence_diagram::bottleneck_distance(this->PD, Cboot.PD);
-        if (verbose)  std::cout << db << std::endl;
-        distribution.push_back(db);
+        boot_PDs.push_back(std::move(Cboot.PD));
+      }
+
+      std::vector<double> boot_distances = Gudhi::persistence_diagram::bottleneck_distances(this->PD, boot_PDs);
+      for (unsigned int i = 0; i < boot_distances.size(); i++) {
+        if (verbose)  std::cout << "Bottleneck distance of the " << i << "th bootstrap = " << boot_distances[i] << std::endl;
+        distribution.push_back(boot_distances[i]);
       }
 
       std::sort(distribution.begin(), distribution.end());
@@ -268,6 +268,8 @@ namespace Persistence_representations {
  for the <i>Sliced Wasserstein kernel</i>---see \cite pmlr-v70-carriere17a, which takes the form of a Gaussian kernel with a specific distance between persistence diagrams
  called the <i>Sliced Wasserstein distance</i>: \f$k(D_1,D_2)={\rm exp}\left(-\frac{SW(D_1,D_2)}{2\sigma^2}\right)\f$. Other kernels such as the Persistence Weighted Gaussian kernel or
  the Persistence Scale Space kernel are implemented in Persistence_heat_maps.
+ The Gram matrix of the Sliced Wasserstein kernel on a list of persistence diagrams, as needed by kernel methods, is
+ computed in parallel by \ref Gudhi::Persistence_representations::sliced_wasserstein_kernel_matrix.
 
  When launching:
 
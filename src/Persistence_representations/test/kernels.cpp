@@ -49,3 +49,25 @@ BOOST_AUTO_TEST_CASE(check_SW) {
   SW sw2(v2, 1.0, 100); SW swex2(v2, 1.0, -1);
   BOOST_CHECK(std::abs(sw1.compute_scalar_product(sw2) - swex1.compute_scalar_product(swex2)) <= 1e-1);
 }
+
+BOOST_AUTO_TEST_CASE(check_SW_kernel_matrix) {
+  std::vector<Persistence_diagram> diagrams(4);
+  diagrams[0].emplace_back(0,1);
+  diagrams[1].emplace_back(0,2);
+  diagrams[2].emplace_back(1,3); diagrams[2].emplace_back(0,4);
+  for (int approx : {100, -1}) {
+    std::vector<std::vector<double> > matrix = Gudhi::Persistence_representations::sliced_wasserstein_kernel_matrix(diagrams, 1.0, approx);
+    BOOST_CHECK(matrix.size() == diagrams.size());
+    for (std::size_t i = 0; i < diagrams.size(); i++) {
+      SW swi(diagrams[i], 1.0, approx);
+      BOOST_CHECK(matrix[i][i] == 1.);
+      for (std::size_t j = 0; j < diagrams.size(); j++) {
+        SW swj(diagrams[j], 1.0, approx);
+        BOOST_CHECK(matrix[i][j] == matrix[j][i]);
+        // the exact distance is computed on randomly perturbed diagrams
+        BOOST_CHECK(std::abs(matrix[i][j] - swi.compute_scalar_product(swj)) <= (approx == -1 ? 1e-2 : 1e-15));
+      }
+    }
+  }
+  BOOST_CHECK(Gudhi::Persistence_representations::sliced_wasserstein_kernel_matrix(std::vector<Persistence_diagram>()).empty());
+}
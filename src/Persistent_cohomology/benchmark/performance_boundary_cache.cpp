@@ -0,0 +1,93 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Points_off_io.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort
+#include <cstdlib>  // for std::atof, std::atoi
+#include <cstddef>  // for std::size_t
+
+struct Simplex_tree_options_cached_boundaries : Gudhi::Simplex_tree_options_fast_persistence {
+  static const bool cache_boundaries = true;
+};
+
+// Types definition
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Cached_simplex_tree = Gudhi::Simplex_tree<Simplex_tree_options_cached_boundaries>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Point = std::vector<double>;
+using Points_off_reader = Gudhi::Points_off_reader<Point>;
+using Diagram = std::vector<std::vector<std::pair<Filtration_value, Filtration_value>>>;
+
+/* Sorts the filtration, iterates once on all the boundaries, then computes the persistence diagram of st in Z/pZ,
+ * and returns it sorted. */
+template<typename SimplexTree>
+Diagram timing_persistence(const std::string& msg, Rips_complex& rips, int dim_max, int p) {
+  std::cout << msg << std::endl;
+  SimplexTree st;
+  rips.create_complex(st, dim_max);
+
+  Gudhi::Clock sort_clock("  Sort the filtration");
+  st.initialize_filtration();
+  std::cout << sort_clock;
+
+  Gudhi::Clock boundary_clock("  Iterate on the boundaries");
+  std::size_t num_faces = 0;
+  for (auto sh : st.filtration_simplex_range())
+    for (auto b_sh : st.boundary_simplex_range(sh)) {
+      (void) b_sh;
+      ++num_faces;
+    }
+  std::cout << boundary_clock << "  (" << num_faces << " faces)" << std::endl;
+
+  Gudhi::Clock persistence_clock("  Persistent_cohomology");
+  Gudhi::persistent_cohomology::Persistent_cohomology<SimplexTree, Field_Zp> pers(st);
+  pers.init_coefficients(p);
+  pers.compute_persistent_cohomology();
+  Diagram diagram;
+  for (int dim = 0; dim < st.dimension(); ++dim) {
+    diagram.push_back(pers.intervals_in_dimension(dim));
+    std::sort(diagram.back().begin(), diagram.back().end());
+  }
+  std::cout << persistence_clock;
+  return diagram;
+}
+
+/* Compares the boundary traversal of the Simplex_tree with and without cache, on the Rips complex of a point cloud.
+ * Default values are the ones of performance_rips_persistence (Klein bottle sampling embedded in dimension 5).
+ * Usage: performance_boundary_cache [off_file [threshold [dim_max [p]]]] */
+int main(int argc, char * argv[]) {
+  std::string off_file_points = "Kl.off";
+  Filtration_value threshold = 0.27;
+  int dim_max = 3;
+  int p = 2;
+  if (argc > 1) off_file_points = argv[1];
+  if (argc > 2) threshold = std::atof(argv[2]);
+  if (argc > 3) dim_max = std::atoi(argv[3]);
+  if (argc > 4) p = std::atoi(argv[4]);
+
+  Points_off_reader off_reader(off_file_points);
+  Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+
+  Diagram reference = timing_persistence<Simplex_tree>("Simplex_tree without boundary cache", rips_complex_from_file,
+                                                       dim_max, p);
+  Diagram diagram = timing_persistence<Cached_simplex_tree>("Simplex_tree with boundary cache",
+                                                            rips_complex_from_file, dim_max, p);
+  if (diagram != reference) std::cout << "Different diagrams!" << std::endl;
+  return 0;
+}
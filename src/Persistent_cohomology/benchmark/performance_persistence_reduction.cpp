@@ -0,0 +1,93 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Flat_filtered_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistent_homology_reduction.h>
+#include <gudhi/Points_off_io.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort
+#include <cstdlib>  // for std::atof, std::atoi
+
+// Types definition
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Flat_complex = Gudhi::Flat_filtered_complex<Filtration_value, Simplex_tree::Simplex_key,
+                                                  Simplex_tree::Vertex_handle>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Point = std::vector<double>;
+using Points_off_reader = Gudhi::Points_off_reader<Point>;
+using Diagram = std::vector<std::vector<std::pair<Filtration_value, Filtration_value>>>;
+
+/* Computes the persistence diagram of cpx in Z/pZ with the engine Persistence, and returns it sorted. */
+template<typename Persistence, typename FilteredComplex>
+Diagram timing_persistence(const std::string& msg, FilteredComplex& cpx, int p) {
+  Gudhi::Clock clock("  " + msg);
+  Persistence pers(cpx);
+  pers.init_coefficients(p);
+  pers.compute_persistent_cohomology();
+  Diagram diagram;
+  for (int dim = 0; dim < cpx.dimension(); ++dim) {
+    diagram.push_back(pers.intervals_in_dimension(dim));
+    std::sort(diagram.back().begin(), diagram.back().end());
+  }
+  std::cout << clock;
+  return diagram;
+}
+
+/* Compares Persistent_cohomology and Persistent_homology_reduction, on a Simplex_tree and on a
+ * Flat_filtered_complex, for the Rips complex of a point cloud.
+ * Default values are the ones of performance_rips_persistence (Klein bottle sampling embedded in dimension 5).
+ * Usage: performance_persistence_reduction [off_file [threshold [dim_max [p]]]] */
+int main(int argc, char * argv[]) {
+  std::string off_file_points = "Kl.off";
+  Filtration_value threshold = 0.27;
+  int dim_max = 3;
+  int p = 2;
+  if (argc > 1) off_file_points = argv[1];
+  if (argc > 2) threshold = std::atof(argv[2]);
+  if (argc > 3) dim_max = std::atoi(argv[3]);
+  if (argc > 4) p = std::atoi(argv[4]);
+
+  Points_off_reader off_reader(off_file_points);
+  Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+  Simplex_tree st;
+  rips_complex_from_file.create_complex(st, dim_max);
+  std::cout << "The complex contains " << st.num_simplices() << " simplices - dimension " << st.dimension()
+      << std::endl;
+
+  Gudhi::Clock clock("Sort the filtration and convert the simplex tree into a flat filtered complex");
+  st.initialize_filtration();
+  Flat_complex flat(st);
+  std::cout << clock;
+
+  using Gudhi::persistent_cohomology::Persistent_cohomology;
+  using Gudhi::persistent_cohomology::Persistent_homology_reduction;
+  std::cout << "Persistence in Z/" << p << "Z:" << std::endl;
+  Diagram reference =
+      timing_persistence<Persistent_cohomology<Simplex_tree, Field_Zp>>("Persistent_cohomology on Simplex_tree", st, p);
+  Diagram diagram =
+      timing_persistence<Persistent_cohomology<Flat_complex, Field_Zp>>("Persistent_cohomology on flat complex", flat,
+                                                                        p);
+  if (diagram != reference) std::cout << "  Different diagrams!" << std::endl;
+  diagram = timing_persistence<Persistent_homology_reduction<Simplex_tree>>("Persistent_homology_reduction on "
+                                                                           "Simplex_tree", st, p);
+  if (diagram != reference) std::cout << "  Different diagrams!" << std::endl;
+  diagram = timing_persistence<Persistent_homology_reduction<Flat_complex>>("Persistent_homology_reduction on "
+                                                                           "flat complex", flat, p);
+  if (diagram != reference) std::cout << "  Different diagrams!" << std::endl;
+  return 0;
+}
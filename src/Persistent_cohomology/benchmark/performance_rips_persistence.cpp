@@ -14,6 +14,7 @@
 #include <gudhi/Persistent_cohomology.h>
 #include <gudhi/Persistent_cohomology/Multi_field.h>
 #include <gudhi/Hasse_complex.h>
+#include <gudhi/Flat_filtered_complex.h>
 #include <gudhi/Points_off_io.h>
 
 #include <chrono>
@@ -28,6 +29,8 @@ using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
 using Multi_field = Gudhi::persistent_cohomology::Multi_field;
 using Point = std::vector<double>;
 using Points_off_reader = Gudhi::Points_off_reader<Point>;
+using Flat_complex = Gudhi::Flat_filtered_complex<Filtration_value, Simplex_tree::Simplex_key,
+                                                  Simplex_tree::Vertex_handle>;
 
 /* Compute the persistent homology of the complex cpx with coefficients in Z/pZ. */
 template< typename FilteredComplex>
@@ -41,6 +44,14 @@ void timing_persistence(FilteredComplex & cpx
                         , int p
                         , int q);
 
+/* Print the allocation counters of a persistence computation. */
+template< typename Persistence>
+void print_memory_statistics(const Persistence & pcoh);
+
+/* Iterate over the boundaries of all the simplices of the complex cpx, in filtration order. */
+template< typename FilteredComplex>
+void timing_boundary_traversal(FilteredComplex & cpx);
+
 /* Timings for the computation of persistent homology with different 
  * representations of a Rips complex and different coefficient fields. The 
  * Rips complex is built on a set of 10000 points sampling a Klein bottle embedded 
@@ -51,6 +62,8 @@ void timing_persistence(FilteredComplex & cpx
  * a faster computation of persistence because boundaries are precomputed. 
  * Hovewer, the simplex tree may be constructed directly from a point cloud and
  * is more compact.
+ * The flat filtered complex stores the same boundaries in a single array, in
+ * filtration order, and is more compact than both.
  * We compute persistent homology with coefficient fields Z/2Z and Z/1223Z.
  * We present also timings for the computation of multi-field persistent 
  * homology in all fields Z/rZ for r prime between 2 and 1223.
@@ -115,6 +128,30 @@ int main(int argc, char * argv[]) {
   elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   std::cout << "Convert the simplex tree into a Hasse diagram in " << elapsed_sec << " ms.\n";
 
+  // Convert the simplex tree into a flat filtered complex
+  start = std::chrono::system_clock::now();
+  Flat_complex flat_cpx(st);
+  end = std::chrono::system_clock::now();
+  elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+  std::cout << "Convert the simplex tree into a flat filtered complex in " << elapsed_sec << " ms.\n";
+
+  // Lower bound on the memory used by the simplex tree: nodes, Siblings and sorted filtration
+  std::size_t num_siblings = 0;
+  for (auto sh : st.complex_simplex_range())
+    if (st.has_children(sh)) ++num_siblings;
+  std::size_t st_bytes = st.num_simplices() * (sizeof(Simplex_tree::Dictionary::value_type)
+                                               + sizeof(Simplex_tree::Simplex_handle))
+                         + (num_siblings + 1) * sizeof(Simplex_tree::Siblings);
+  std::cout << "Memory used by the simplex tree:            at least " << st_bytes / 1024 << " kB.\n";
+  std::cout << "Memory used by the flat filtered complex:   " << flat_cpx.size_in_bytes() / 1024 << " kB.\n";
+
+  std::cout << "Boundary traversal when using a simplex tree: \n";
+  timing_boundary_traversal(st);
+  std::cout << "Boundary traversal when using a Hasse complex: \n";
+  timing_boundary_traversal(hcpx);
+  std::cout << "Boundary traversal when using a flat filtered complex: \n";
+  timing_boundary_traversal(flat_cpx);
+
 
   std::cout << "Timings when using a simplex tree: \n";
   timing_persistence(st, p);
@@ -126,6 +163,11 @@ int main(int argc, char * argv[]) {
   timing_persistence(hcpx, q);
   timing_persistence(hcpx, p, q);
 
+  std::cout << "Timings when using a flat filtered complex: \n";
+  timing_persistence(flat_cpx, p);
+  timing_persistence(flat_cpx, q);
+  timing_persistence(flat_cpx, p, q);
+
   start = std::chrono::system_clock::now();
   }
   end = std::chrono::system_clock::now();
@@ -160,6 +202,7 @@ timing_persistence(FilteredComplex & cpx
   end = std::chrono::system_clock::now();
   elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   std::cout << "  Compute persistent homology in Z/" << p << "Z in " << elapsed_sec << " ms.\n";
+  print_memory_statistics(pcoh);
   start = std::chrono::system_clock::now();
   }
   end = std::chrono::system_clock::now();
@@ -196,9 +239,34 @@ timing_persistence(FilteredComplex & cpx
   elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   std::cout << "  Compute multi-field persistent homology in all coefficient fields Z/pZ "
       << "with p in [" << p << ";" << q << "] in " << elapsed_sec << " ms.\n";
+  print_memory_statistics(pcoh);
   start = std::chrono::system_clock::now();
   }
   end = std::chrono::system_clock::now();
   elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   std::cout << "  Run the persistence destructors in " << elapsed_sec << " ms.\n";
 }
+
+template< typename FilteredComplex>
+void
+timing_boundary_traversal(FilteredComplex & cpx) {
+  std::chrono::time_point<std::chrono::system_clock> start, end;
+  start = std::chrono::system_clock::now();
+  double sum = 0.;
+  for (auto sh : cpx.filtration_simplex_range())
+    for (auto b_sh : cpx.boundary_simplex_range(sh))
+      sum += cpx.filtration(b_sh);
+  end = std::chrono::system_clock::now();
+  int elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+  std::cout << "  Iterate over all the boundaries in " << elapsed_sec << " ms (checksum " << sum << ").\n";
+}
+
+template< typename Persistence>
+void
+print_memory_statistics(const Persistence & pcoh) {
+  auto statistics = pcoh.memory_statistics();
+  std::cout << "  Allocated " << statistics.cell_allocations << " cells, " << statistics.column_allocations
+      << " columns and " << statistics.row_allocations << " rows - peak memory of the annotation matrix "
+      << statistics.peak_matrix_bytes / 1024 << " kB - arrays indexed by key " << statistics.array_bytes / 1024
+      << " kB.\n";
+}
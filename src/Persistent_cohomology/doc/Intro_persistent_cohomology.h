@@ -129,6 +129,13 @@ namespace persistent_cohomology {
  by increasing filtration values (breaking ties so as a simplex appears after
  its subsimplices of same filtration value) provides an indexing scheme.
 
+\section pcohstreaming Streaming the intervals
+ By default, `Gudhi::persistent_cohomology::Persistent_cohomology` stores all the persistence intervals, which
+ `output_diagram()` sorts before writing them. For filtrations with many intervals, `compute_persistent_cohomology()`
+ also accepts a sink, that receives each interval as soon as it is computed, after the filtering by length. The sinks
+ `Gudhi::persistent_cohomology::Persistence_text_sink` and `Gudhi::persistent_cohomology::Persistence_binary_sink`
+ write the intervals to a stream, in the text format of `output_diagram()` or in a compact binary format.
+
 \section pcohexamples Examples
 
 We provide several example files: run these examples with -h for details on their use, and read the README file.
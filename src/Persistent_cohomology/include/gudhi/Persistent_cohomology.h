@@ -15,13 +15,13 @@
 
 #include <gudhi/Persistent_cohomology/Persistent_cohomology_column.h>
 #include <gudhi/Persistent_cohomology/Field_Zp.h>
+#include <gudhi/Persistent_cohomology/Persistence_sinks.h>
 #include <gudhi/Simple_object_pool.h>
 
 #include <boost/intrusive/set.hpp>
 #include <boost/pending/disjoint_sets.hpp>
 #include <boost/intrusive/list.hpp>
 
-#include <map>
 #include <utility>
 #include <list>
 #include <vector>
@@ -32,6 +32,9 @@
 #include <algorithm>
 #include <string>
 #include <stdexcept>  // for std::out_of_range
+#include <cstddef>  // for std::size_t
+#include <functional>  // for std::function
+#include <type_traits>  // for std::enable_if
 
 namespace Gudhi {
 
@@ -67,6 +70,22 @@ class Persistent_cohomology {
    * The Arith_element field is used for the multi-field framework. */
   typedef std::tuple<Simplex_handle, Simplex_handle, Arith_element> Persistent_interval;
 
+  /** \brief Allocation counters of the compressed annotation matrix, returned by `memory_statistics()`. */
+  struct Memory_statistics {
+    /** \brief Number of cells allocated since the construction. */
+    std::size_t cell_allocations = 0;
+    /** \brief Number of columns allocated since the construction. */
+    std::size_t column_allocations = 0;
+    /** \brief Number of rows allocated since the construction. */
+    std::size_t row_allocations = 0;
+    /** \brief Number of bytes used by the cells, columns and rows alive. */
+    std::size_t matrix_bytes = 0;
+    /** \brief Maximal value reached by `matrix_bytes`. */
+    std::size_t peak_matrix_bytes = 0;
+    /** \brief Number of bytes used by the arrays indexed by `Simplex_key`. */
+    std::size_t array_bytes = 0;
+  };
+
  private:
   // Compressed Annotation Matrix types:
   // Column type
@@ -83,6 +102,35 @@ class Persistent_cohomology {
   // Sparse column type for the annotation of the boundary of an element.
   typedef std::vector<std::pair<Simplex_key, Arith_element> > A_ds_type;
 
+  // Simple_object_pool that updates the Memory_statistics.
+  template<class T>
+  class Counted_object_pool : public Simple_object_pool<T> {
+   public:
+    Counted_object_pool(Memory_statistics& statistics, std::size_t Memory_statistics::* allocations)
+        : statistics_(&statistics),
+          allocations_(allocations) {
+    }
+
+    template<class...U>
+    T* construct(U&&...u) {
+      T* p = Simple_object_pool<T>::construct(std::forward<U>(u)...);
+      ++(statistics_->*allocations_);
+      statistics_->matrix_bytes += sizeof(T);
+      if (statistics_->matrix_bytes > statistics_->peak_matrix_bytes)
+        statistics_->peak_matrix_bytes = statistics_->matrix_bytes;
+      return p;
+    }
+
+    void destroy(T* p) {
+      Simple_object_pool<T>::destroy(p);
+      statistics_->matrix_bytes -= sizeof(T);
+    }
+
+   private:
+    Memory_statistics* statistics_;
+    std::size_t Memory_statistics::* allocations_;
+  };
+
  public:
   /** \brief Initializes the Persistent_cohomology class.
    *
@@ -104,12 +152,15 @@ class Persistent_cohomology {
         ds_repr_(num_simplices_, NULL),                  // union-find -> annotation vectors
         dsets_(&ds_rank_[0], &ds_parent_[0]),            // union-find
         cam_(),                                          // collection of annotation vectors
-        zero_cocycles_(),                                // union-find -> Simplex_key of creator for 0-homology
-        transverse_idx_(),                               // key -> row
+        zero_cocycles_(num_simplices_, cpx.null_key()),  // union-find -> Simplex_key of creator for 0-homology
+        transverse_idx_(num_simplices_, nullptr),        // key -> row
         persistent_pairs_(),
+        sink_(),
         interval_length_policy(&cpx, 0),
-        column_pool_(),  // memory pools for the CAM
-        cell_pool_() {
+        statistics_(),
+        column_pool_(statistics_, &Memory_statistics::column_allocations),  // memory pools for the CAM
+        cell_pool_(statistics_, &Memory_statistics::cell_allocations),
+        row_pool_(statistics_, &Memory_statistics::row_allocations) {
     if (cpx_->num_simplices() > std::numeric_limits<Simplex_key>::max()) {
       // num_simplices must be strictly lower than the limit, because a value is reserved for null_key.
       throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
@@ -127,10 +178,12 @@ class Persistent_cohomology {
 
   ~Persistent_cohomology() {
     // Clean the transversal lists
-    for (auto & transverse_ref : transverse_idx_) {
-      // Destruct all the cells
-      transverse_ref.second.row_->clear_and_dispose([&](Cell*p){p->~Cell();});
-      delete transverse_ref.second.row_;
+    for (cocycle* row : transverse_idx_) {
+      if (row != nullptr) {
+        // Destruct all the cells
+        row->row_.clear_and_dispose([&](Cell*p){p->~Cell();});
+        row->~cocycle();
+      }
     }
   }
 
@@ -193,23 +246,78 @@ class Persistent_cohomology {
       key = cpx_->key(v_sh);
 
       if (ds_parent_[key] == key  // root of its tree
-      && zero_cocycles_.find(key) == zero_cocycles_.end()) {
-        persistent_pairs_.emplace_back(
-            cpx_->simplex(key), cpx_->null_simplex(), coeff_field_.characteristic());
+      && zero_cocycles_[key] == cpx_->null_key()) {
+        add_interval(cpx_->simplex(key), cpx_->null_simplex(), coeff_field_.characteristic());
       }
     }
-    for (auto zero_idx : zero_cocycles_) {
-      persistent_pairs_.emplace_back(
-          cpx_->simplex(zero_idx.second), cpx_->null_simplex(), coeff_field_.characteristic());
+    for (Simplex_key zero_idx : zero_cocycles_) {
+      if (zero_idx != cpx_->null_key()) {
+        add_interval(cpx_->simplex(zero_idx), cpx_->null_simplex(), coeff_field_.characteristic());
+      }
     }
     // Compute infinite interval of dimension > 0
-    for (auto cocycle : transverse_idx_) {
-      persistent_pairs_.emplace_back(
-          cpx_->simplex(cocycle.first), cpx_->null_simplex(), cocycle.second.characteristics_);
+    for (std::size_t key = 0; key < transverse_idx_.size(); ++key) {
+      if (transverse_idx_[key] != nullptr) {
+        add_interval(cpx_->simplex(key), cpx_->null_simplex(), transverse_idx_[key]->characteristics_);
+      }
     }
   }
 
+  /** \brief Compute the persistent homology of the filtered simplicial complex, and pass each interval to sink as
+   * soon as it is known, instead of storing it.
+   *
+   * `sink(birth, death, dim, charac)` is called once per interval, where birth and death are the `Simplex_handle` of
+   * the simplices that create and destroy the interval (`null_simplex()` for an infinite interval), dim its dimension
+   * and charac the product of the characteristics of the fields it exists in. The intervals are produced in the order
+   * of their death, followed by the infinite intervals, and the ones of length less or equal than
+   * min_interval_length are discarded before reaching the sink. `Persistence_text_sink` and `Persistence_binary_sink`
+   * write them to a stream.
+   *
+   * The intervals are not stored, so that `get_persistent_pairs()`, `output_diagram()` and the Betti numbers
+   * functions see an empty diagram after this call.
+   *
+   * @param[in] sink                callable, taken by reference.
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   */
+  template<class PersistenceSink>
+  typename std::enable_if<!std::is_arithmetic<typename std::decay<PersistenceSink>::type>::value>::type
+  compute_persistent_cohomology(PersistenceSink&& sink, Filtration_value min_interval_length = 0) {
+    sink_ = [this, &sink](Simplex_handle birth, Simplex_handle death, const Arith_element& charac) {
+      sink(birth, death, cpx_->dimension(birth), charac);
+    };
+    try {
+      compute_persistent_cohomology(min_interval_length);
+    } catch (...) {
+      sink_ = nullptr;
+      throw;
+    }
+    sink_ = nullptr;
+  }
+
+  /** \brief Returns the allocation counters of the compressed annotation matrix, and the memory used by the arrays
+   * indexed by `Simplex_key`. */
+  Memory_statistics memory_statistics() const {
+    Memory_statistics statistics = statistics_;
+    statistics.array_bytes = ds_rank_.capacity() * sizeof(int)
+        + ds_parent_.capacity() * sizeof(Simplex_key)
+        + ds_repr_.capacity() * sizeof(Column *)
+        + zero_cocycles_.capacity() * sizeof(Simplex_key)
+        + transverse_idx_.capacity() * sizeof(cocycle *)
+        + touched_keys_.capacity() * sizeof(Simplex_key)
+        + a_ds_.capacity() * sizeof(typename A_ds_type::value_type);
+    return statistics;
+  }
+
  private:
+  /* Stores the interval, or passes it to the sink of compute_persistent_cohomology(sink, min_interval_length). */
+  void add_interval(Simplex_handle birth, Simplex_handle death, const Arith_element& charac) {
+    if (sink_)
+      sink_(birth, death, charac);
+    else
+      persistent_pairs_.emplace_back(birth, death, charac);
+  }
+
   /** \brief Update the cohomology groups under the insertion of an edge.
    *
    * The 0-homology is maintained with a simple Union-Find data structure, which
@@ -225,52 +333,37 @@ class Persistent_cohomology {
       dsets_.link(ku, kv);
       // Keys of the simplices which created the connected components containing
       // respectively u and v.
-      Simplex_key idx_coc_u, idx_coc_v;
-      auto map_it_u = zero_cocycles_.find(ku);
+      Simplex_key idx_coc_u = zero_cocycles_[ku];
       // If the index of the cocycle representing the class is already ku.
-      if (map_it_u == zero_cocycles_.end()) {
+      if (idx_coc_u == cpx_->null_key()) {
         idx_coc_u = ku;
-      } else {
-        idx_coc_u = map_it_u->second;
       }
 
-      auto map_it_v = zero_cocycles_.find(kv);
+      Simplex_key idx_coc_v = zero_cocycles_[kv];
       // If the index of the cocycle representing the class is already kv.
-      if (map_it_v == zero_cocycles_.end()) {
+      if (idx_coc_v == cpx_->null_key()) {
         idx_coc_v = kv;
-      } else {
-        idx_coc_v = map_it_v->second;
       }
 
       if (cpx_->filtration(cpx_->simplex(idx_coc_u))
           < cpx_->filtration(cpx_->simplex(idx_coc_v))) {  // Kill cocycle [idx_coc_v], which is younger.
         if (interval_length_policy(cpx_->simplex(idx_coc_v), sigma)) {
-          persistent_pairs_.emplace_back(
-              cpx_->simplex(idx_coc_v), sigma, coeff_field_.characteristic());
+          add_interval(cpx_->simplex(idx_coc_v), sigma, coeff_field_.characteristic());
         }
         // Maintain the index of the 0-cocycle alive.
-        if (kv != idx_coc_v) {
-          zero_cocycles_.erase(map_it_v);
-        }
+        zero_cocycles_[kv] = cpx_->null_key();
         if (kv == dsets_.find_set(kv)) {
-          if (ku != idx_coc_u) {
-            zero_cocycles_.erase(map_it_u);
-          }
+          zero_cocycles_[ku] = cpx_->null_key();
           zero_cocycles_[kv] = idx_coc_u;
         }
       } else {  // Kill cocycle [idx_coc_u], which is younger.
         if (interval_length_policy(cpx_->simplex(idx_coc_u), sigma)) {
-          persistent_pairs_.emplace_back(
-              cpx_->simplex(idx_coc_u), sigma, coeff_field_.characteristic());
+          add_interval(cpx_->simplex(idx_coc_u), sigma, coeff_field_.characteristic());
         }
         // Maintain the index of the 0-cocycle alive.
-        if (ku != idx_coc_u) {
-          zero_cocycles_.erase(map_it_u);
-        }
+        zero_cocycles_[ku] = cpx_->null_key();
         if (ku == dsets_.find_set(ku)) {
-          if (kv != idx_coc_v) {
-            zero_cocycles_.erase(map_it_v);
-          }
+          zero_cocycles_[kv] = cpx_->null_key();
           zero_cocycles_[ku] = idx_coc_v;
         }
       }
@@ -281,11 +374,9 @@ class Persistent_cohomology {
   }
 
   /*
-   * Compute the annotation of the boundary of a simplex.
+   * Compute the annotation of the boundary of a simplex, as a sparse vector sorted by key.
    */
-  void annotation_of_the_boundary(
-      std::map<Simplex_key, Arith_element> & map_a_ds, Simplex_handle sigma,
-      int dim_sigma) {
+  void annotation_of_the_boundary(A_ds_type & a_ds, Simplex_handle sigma, int dim_sigma) {
     // traverses the boundary of sigma, keeps track of the annotation vectors,
     // with multiplicity. We used to sum the coefficients directly in
     // annotations_in_boundary by using a map, we now do it later.
@@ -315,10 +406,8 @@ class Persistent_cohomology {
     std::sort(annotations_in_boundary.begin(), annotations_in_boundary.end(),
               [](annotation_t const& a, annotation_t const& b) { return a.first < b.first; });
 
-    // Sum the annotations with multiplicity, using a map<key,coeff>
-    // to represent a sparse vector.
-    std::pair<typename std::map<Simplex_key, Arith_element>::iterator, bool> result_insert_a_ds;
-
+    // Sum the annotations with multiplicity, using the accumulator of the rows of the CAM,
+    // and remember in touched_keys_ which of them may be non-zero.
     for (auto ann_it = annotations_in_boundary.begin(); ann_it != annotations_in_boundary.end(); /**/) {
       Column* col = ann_it->first;
       int mult = ann_it->second;
@@ -327,45 +416,47 @@ class Persistent_cohomology {
       }
       // The following test is just a heuristic, it is not required, and it is fine that is misses p == 0.
       if (mult != coeff_field_.additive_identity()) {  // For all columns in the boundary,
-        for (auto cell_ref : col->col_) {  // insert every cell in map_a_ds with multiplicity
+        for (auto& cell_ref : col->col_) {  // add every cell to the accumulator with multiplicity
           Arith_element w_y = coeff_field_.times(cell_ref.coefficient_, mult);  // coefficient * multiplicity
 
           if (w_y != coeff_field_.additive_identity()) {  // if != 0
-            result_insert_a_ds = map_a_ds.insert(std::pair<Simplex_key, Arith_element>(cell_ref.key_, w_y));
-            if (!(result_insert_a_ds.second)) {  // if cell_ref.key_ already a Key in map_a_ds
-              result_insert_a_ds.first->second = coeff_field_.plus_equal(result_insert_a_ds.first->second, w_y);
-              if (result_insert_a_ds.first->second == coeff_field_.additive_identity()) {
-                map_a_ds.erase(result_insert_a_ds.first);
-              }
+            Arith_element& entry = transverse_idx_[cell_ref.key_]->accumulator_;
+            if (entry == coeff_field_.additive_identity()) {
+              touched_keys_.push_back(cell_ref.key_);
             }
+            entry = coeff_field_.plus_equal(entry, w_y);
           }
         }
       }
     }
+    // A key is touched again if its entry went back to zero, hence the std::unique.
+    std::sort(touched_keys_.begin(), touched_keys_.end());
+    touched_keys_.erase(std::unique(touched_keys_.begin(), touched_keys_.end()), touched_keys_.end());
+    for (Simplex_key key : touched_keys_) {
+      Arith_element& entry = transverse_idx_[key]->accumulator_;
+      if (entry != coeff_field_.additive_identity()) {
+        a_ds.emplace_back(key, entry);
+        entry = coeff_field_.additive_identity();
+      }
+    }
+    touched_keys_.clear();
   }
 
   /*
    * Update the cohomology groups under the insertion of a simplex.
    */
   void update_cohomology_groups(Simplex_handle sigma, int dim_sigma) {
-// Compute the annotation of the boundary of sigma:
-    std::map<Simplex_key, Arith_element> map_a_ds;
-    annotation_of_the_boundary(map_a_ds, sigma, dim_sigma);
+// Compute the annotation of the boundary of sigma, in a_ds_ which is reused from one simplex to the next:
+    A_ds_type& a_ds = a_ds_;
+    a_ds.clear();
+    annotation_of_the_boundary(a_ds, sigma, dim_sigma);
 // Update the cohomology groups:
-    if (map_a_ds.empty()) {  // sigma is a creator in all fields represented in coeff_field_
+    if (a_ds.empty()) {  // sigma is a creator in all fields represented in coeff_field_
       if (dim_sigma < dim_max_) {
         create_cocycle(sigma, coeff_field_.multiplicative_identity(),
                        coeff_field_.characteristic());
       }
     } else {        // sigma is a destructor in at least a field in coeff_field_
-      // Convert map_a_ds to a vector
-      A_ds_type a_ds;  // admits reverse iterators
-      for (auto map_a_ds_ref : map_a_ds) {
-        a_ds.push_back(
-            std::pair<Simplex_key, Arith_element>(map_a_ds_ref.first,
-                                                  map_a_ds_ref.second));
-      }
-
       Arith_element inv_x, charac;
       Arith_element prod = coeff_field_.characteristic();  // Product of characteristic of the fields
       for (auto a_ds_rit = a_ds.rbegin();
@@ -404,9 +495,9 @@ class Persistent_cohomology {
     // biggest key used so far.
     cam_.insert(cam_.end(), *new_col);
     // Update the disjoint sets data structure.
-    Hcell * new_hcell = new Hcell;
-    new_hcell->push_back(*new_cell);
-    transverse_idx_[key] = cocycle(charac, new_hcell);  // insert the new row
+    cocycle * new_row = row_pool_.construct(charac, coeff_field_.additive_identity());
+    new_row->row_.push_back(*new_cell);
+    transverse_idx_[key] = new_row;  // insert the new row
     ds_repr_[key] = new_col;
   }
 
@@ -423,17 +514,17 @@ class Persistent_cohomology {
                        Arith_element charac) {
     // Create a finite persistent interval for which the interval exists
     if (interval_length_policy(cpx_->simplex(death_key), sigma)) {
-      persistent_pairs_.emplace_back(cpx_->simplex(death_key)  // creator
-          , sigma                                              // destructor
-          , charac);                                           // fields
+      add_interval(cpx_->simplex(death_key)  // creator
+          , sigma                              // destructor
+          , charac);                           // fields
     }
 
-    auto death_key_row = transverse_idx_.find(death_key);  // Find the beginning of the row.
+    cocycle * death_key_row = transverse_idx_[death_key];  // Find the beginning of the row.
     std::pair<typename Cam::iterator, bool> result_insert_cam;
 
-    auto row_cell_it = death_key_row->second.row_->begin();
+    auto row_cell_it = death_key_row->row_.begin();
 
-    while (row_cell_it != death_key_row->second.row_->end()) {  // Traverse all cells in
+    while (row_cell_it != death_key_row->row_.end()) {  // Traverse all cells in
       // the row at index death_key.
       Arith_element w = coeff_field_.times_minus(inv_x, row_cell_it->coefficient_);
 
@@ -459,7 +550,7 @@ class Persistent_cohomology {
           if (result_insert_cam.second) {  // If it was not in the CAM before: insertion has succeeded
             for (auto& col_cell : curr_col->col_) {
               // re-establish the row links
-              transverse_idx_[col_cell.key_].row_->push_front(col_cell);
+              transverse_idx_[col_cell.key_]->row_.push_front(col_cell);
             }
           } else {  // There is already an identical column in the CAM:
             // merge two disjoint sets.
@@ -483,11 +574,11 @@ class Persistent_cohomology {
     if (charac == coeff_field_.characteristic()) {
       cpx_->assign_key(sigma, cpx_->null_key());
     }
-    if (death_key_row->second.characteristics_ == charac) {
-      delete death_key_row->second.row_;
-      transverse_idx_.erase(death_key_row);
+    if (death_key_row->characteristics_ == charac) {
+      row_pool_.destroy(death_key_row);
+      transverse_idx_[death_key] = nullptr;
     } else {
-      death_key_row->second.characteristics_ /= charac;
+      death_key_row->characteristics_ /= charac;
     }
   }
 
@@ -626,7 +717,7 @@ class Persistent_cohomology {
     for (auto pair : persistent_pairs_) {
       // Count never ended persistence intervals
       if (cpx_->null_simplex() == get<1>(pair)) {
-        if (cpx_->dimension(get<0>(pair)) == dimension) {
+        if (static_cast<int>(cpx_->dimension(get<0>(pair))) == dimension) {
           // Increment betti number found
           ++betti_number;
         }
@@ -671,7 +762,7 @@ class Persistent_cohomology {
       // still work if we change the complex filtration function to reject null simplices.
       if (cpx_->filtration(get<0>(pair)) <= from &&
           (get<1>(pair) == cpx_->null_simplex() || cpx_->filtration(get<1>(pair)) > to)) {
-        if (cpx_->dimension(get<0>(pair)) == dimension) {
+        if (static_cast<int>(cpx_->dimension(get<0>(pair))) == dimension) {
           // Increment betti number found
           ++betti_number;
         }
@@ -696,7 +787,7 @@ class Persistent_cohomology {
     std::vector< std::pair< Filtration_value , Filtration_value > > result;
     // auto && pair, to avoid unnecessary copying
     for (auto && pair : persistent_pairs_) {
-      if (cpx_->dimension(get<0>(pair)) == dimension) {
+      if (static_cast<int>(cpx_->dimension(get<0>(pair))) == dimension) {
         result.emplace_back(cpx_->filtration(get<0>(pair)), cpx_->filtration(get<1>(pair)));
       }
     }
@@ -708,17 +799,15 @@ class Persistent_cohomology {
    * Structure representing a cocycle.
    */
   struct cocycle {
-    cocycle()
-        : row_(nullptr),
-          characteristics_() {
-    }
-    cocycle(Arith_element characteristics, Hcell * row)
-        : row_(row),
-          characteristics_(characteristics) {
+    cocycle(Arith_element characteristics, Arith_element zero)
+        : row_(),
+          characteristics_(characteristics),
+          accumulator_(zero) {
     }
 
-    Hcell * row_;                    // points to the corresponding row in the CAM
+    Hcell row_;                      // the corresponding row in the CAM
     Arith_element characteristics_;  // product of field characteristics for which the cocycle exist
+    Arith_element accumulator_;      // coefficient of the row in the annotation being computed, zero otherwise
   };
 
  public:
@@ -737,18 +826,26 @@ class Persistent_cohomology {
   boost::disjoint_sets<int *, Simplex_key *> dsets_;
   /* The compressed annotation matrix fields.*/
   Cam cam_;
-  /*  Dictionary establishing the correspondance between the Simplex_key of
+  /*  Property map establishing the correspondance between the Simplex_key of
    * the root vertex in the union-find ds and the Simplex_key of the vertex which
-   * created the connected component as a 0-dimension homology feature.*/
-  std::map<Simplex_key, Simplex_key> zero_cocycles_;
-  /*  Key -> row. */
-  std::map<Simplex_key, cocycle> transverse_idx_;
+   * created the connected component as a 0-dimension homology feature, null_key
+   * if it is the root itself.*/
+  std::vector<Simplex_key> zero_cocycles_;
+  /*  Key -> row, nullptr if there is no row for this key. */
+  std::vector<cocycle *> transverse_idx_;
   /* Persistent intervals. */
   std::vector<Persistent_interval> persistent_pairs_;
+  // Receives the intervals instead of persistent_pairs_ when set.
+  std::function<void(Simplex_handle, Simplex_handle, const Arith_element&)> sink_;
   length_interval interval_length_policy;
-
-  Simple_object_pool<Column> column_pool_;
-  Simple_object_pool<Cell> cell_pool_;
+  /* Keys of the rows whose accumulator may be non-zero, and annotation of the boundary of the current simplex.*/
+  std::vector<Simplex_key> touched_keys_;
+  A_ds_type a_ds_;
+
+  Memory_statistics statistics_;
+  Counted_object_pool<Column> column_pool_;
+  Counted_object_pool<Cell> cell_pool_;
+  Counted_object_pool<cocycle> row_pool_;
 };
 
 }  // namespace persistent_cohomology
@@ -0,0 +1,160 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_PERSISTENCE_SINKS_H_
+#define PERSISTENT_COHOMOLOGY_PERSISTENCE_SINKS_H_
+
+#include <iostream>
+#include <limits>  // for std::numeric_limits
+#include <type_traits>  // for std::is_floating_point, std::is_signed
+#include <vector>
+#include <tuple>
+#include <cstdint>  // for std::int32_t, std::uint32_t
+#include <cstring>  // for std::memcmp, std::memcpy
+#include <stdexcept>  // for std::invalid_argument
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Persistence sink that writes each interval to a stream, in the format of
+ * `Persistent_cohomology::output_diagram()`:
+ *    p1*...*pr   dim b d
+ *
+ * \ingroup persistent_cohomology
+ *
+ * The intervals are written in the order they are computed, not sorted by length.
+ */
+template<class FilteredComplex>
+class Persistence_text_sink {
+ public:
+  typedef typename FilteredComplex::Simplex_handle Simplex_handle;
+  typedef typename FilteredComplex::Filtration_value Filtration_value;
+
+  Persistence_text_sink(FilteredComplex& cpx, std::ostream& ostream)
+      : cpx_(&cpx),
+        ostream_(&ostream) {
+  }
+
+  template<class Arith_element>
+  void operator()(Simplex_handle birth, Simplex_handle death, int dimension, const Arith_element& charac) {
+    // Special case on windows, inf is "1.#INF"
+    if (std::numeric_limits<Filtration_value>::has_infinity &&
+        cpx_->filtration(death) == std::numeric_limits<Filtration_value>::infinity()) {
+      *ostream_ << charac << "  " << dimension << " " << cpx_->filtration(birth) << " inf \n";
+    } else {
+      *ostream_ << charac << "  " << dimension << " " << cpx_->filtration(birth) << " " << cpx_->filtration(death)
+          << " \n";
+    }
+  }
+
+ private:
+  FilteredComplex* cpx_;
+  std::ostream* ostream_;
+};
+
+/** \brief Magic number at the beginning of a binary persistence diagram. */
+static const char persistence_binary_magic[8] = {'G', 'U', 'D', 'H', 'I', 'P', 'D', '1'};
+
+/** \brief Type tag that follows the magic number in a binary persistence diagram, 8 bytes: the kind of
+ * `Filtration_value` ('f' for floating point, 'i' for signed integer, 'u' for unsigned integer), its size in bytes,
+ * the size in bytes of the dimensions, a zero byte, and the `std::uint32_t` 0x01020304 in the byte order of the
+ * writer. */
+template<class Filtration_value>
+void persistence_binary_tag(char (&tag)[8]) {
+  const std::uint32_t byte_order = 0x01020304;
+  if (std::is_floating_point<Filtration_value>::value)
+    tag[0] = 'f';
+  else
+    tag[0] = std::is_signed<Filtration_value>::value ? 'i' : 'u';
+  tag[1] = static_cast<char>(sizeof(Filtration_value));
+  tag[2] = static_cast<char>(sizeof(std::int32_t));
+  tag[3] = 0;
+  std::memcpy(tag + 4, &byte_order, sizeof(byte_order));
+}
+
+/** \brief Persistence sink that writes each interval to a stream in a compact binary format.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * The stream must be opened in binary mode. The format is the magic number "GUDHIPD1", the type tag described in
+ * `persistence_binary_tag()`, and for each interval its dimension as a `std::int32_t`, its birth and its death as
+ * `Filtration_value`, all in the native byte order.
+ * The death of an infinite interval is the infinity of `Filtration_value` (or its maximum when it has no
+ * infinity). As with `Persistent_cohomology::write_output_diagram()`, the field characteristic is not stored.
+ *
+ * The diagram can be read back with `read_persistence_binary_diagram()`.
+ */
+template<class FilteredComplex>
+class Persistence_binary_sink {
+ public:
+  typedef typename FilteredComplex::Simplex_handle Simplex_handle;
+  typedef typename FilteredComplex::Filtration_value Filtration_value;
+
+  /** \brief Writes the magic number and the type tag to ostream. */
+  Persistence_binary_sink(FilteredComplex& cpx, std::ostream& ostream)
+      : cpx_(&cpx),
+        ostream_(&ostream) {
+    char tag[8];
+    persistence_binary_tag<Filtration_value>(tag);
+    ostream_->write(persistence_binary_magic, sizeof(persistence_binary_magic));
+    ostream_->write(tag, sizeof(tag));
+  }
+
+  template<class Arith_element>
+  void operator()(Simplex_handle birth, Simplex_handle death, int dimension, const Arith_element&) {
+    std::int32_t dim = dimension;
+    Filtration_value birth_value = cpx_->filtration(birth);
+    Filtration_value death_value = cpx_->filtration(death);
+    if (death == cpx_->null_simplex() && !std::numeric_limits<Filtration_value>::has_infinity)
+      death_value = (std::numeric_limits<Filtration_value>::max)();
+    ostream_->write(reinterpret_cast<const char*>(&dim), sizeof(dim));
+    ostream_->write(reinterpret_cast<const char*>(&birth_value), sizeof(birth_value));
+    ostream_->write(reinterpret_cast<const char*>(&death_value), sizeof(death_value));
+  }
+
+ private:
+  FilteredComplex* cpx_;
+  std::ostream* ostream_;
+};
+
+/** \brief Reads a diagram written by `Persistence_binary_sink`, as (dimension, birth, death) tuples, in the order
+ * they were written.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * \tparam Filtration_value must be the `Filtration_value` of the complex the diagram was computed on.
+ * \exception std::invalid_argument if the stream does not start with the magic number, or if its type tag does not
+ * match `Filtration_value` and the byte order of this machine.
+ */
+template<class Filtration_value>
+std::vector<std::tuple<int, Filtration_value, Filtration_value>> read_persistence_binary_diagram(std::istream& in) {
+  char magic[sizeof(persistence_binary_magic)];
+  if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, persistence_binary_magic, sizeof(magic)) != 0)
+    throw std::invalid_argument("read_persistence_binary_diagram - not a binary persistence diagram.");
+  char tag[8];
+  char expected_tag[8];
+  persistence_binary_tag<Filtration_value>(expected_tag);
+  if (!in.read(tag, sizeof(tag)) || std::memcmp(tag, expected_tag, sizeof(tag)) != 0)
+    throw std::invalid_argument("read_persistence_binary_diagram - the diagram was written with another "
+                                "Filtration_value type or byte order.");
+  std::vector<std::tuple<int, Filtration_value, Filtration_value>> diagram;
+  std::int32_t dim;
+  Filtration_value birth, death;
+  while (in.read(reinterpret_cast<char*>(&dim), sizeof(dim)) &&
+         in.read(reinterpret_cast<char*>(&birth), sizeof(birth)) &&
+         in.read(reinterpret_cast<char*>(&death), sizeof(death))) {
+    diagram.emplace_back(dim, birth, death);
+  }
+  return diagram;
+}
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_PERSISTENCE_SINKS_H_
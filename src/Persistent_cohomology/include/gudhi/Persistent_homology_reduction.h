@@ -0,0 +1,504 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef PERSISTENT_HOMOLOGY_REDUCTION_H_
+#define PERSISTENT_HOMOLOGY_REDUCTION_H_
+
+#include <gudhi/Persistent_cohomology/Field_Zp.h>
+
+#include <vector>
+#include <tuple>
+#include <utility>  // for std::pair, std::swap
+#include <algorithm>  // for std::sort, std::push_heap, std::pop_heap
+#include <deque>
+#include <limits>  // for numeric_limits<>
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint32_t
+#include <iostream>
+#include <fstream>  // std::ofstream
+#include <string>
+#include <stdexcept>  // for std::out_of_range
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Computes the persistent cohomology of a filtered complex by reduction of its coboundary matrix.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * This is an alternative to `Persistent_cohomology`, with the same interface and the same output
+ * (`get_persistent_pairs()`, `intervals_in_dimension()`, ...) for coefficients in \f$\mathbb{Z}/p\mathbb{Z}\f$.
+ * Connected components are computed with a union-find data structure. The coboundaries of the other simplices are
+ * obtained once by transposing the boundaries of the complex into a compressed sparse row matrix, which is then
+ * reduced column by column, where:
+ * - the columns are processed by increasing dimension, so that the columns of the simplices that were paired in the
+ * previous dimension are skipped (clearing, or twist),
+ * - a column whose first entry is not already the pivot of another column, which includes the apparent pairs, is paired
+ * immediately and is not stored,
+ * - the other columns are reduced lazily: they are represented as a linear combination of coboundaries, whose sum is
+ * only enumerated up to its first non-zero entry with a heap, and only this linear combination is stored,
+ * contiguously with the other ones, in a single array.
+ *
+ * Unlike the Rips engines that enumerate the cofaces of a simplex on the fly from its vertices, the coboundary matrix
+ * is stored explicitly, because the `FilteredComplex` concept only gives access to the boundary of a simplex. It
+ * takes one entry (a `Simplex_key` and an `Arith_element`) per facet of each simplex of dimension 2 or more, and a
+ * `std::size_t` per simplex, and the transposition temporarily needs as much memory again for its buckets.
+ *
+ * It does not support multi-field persistent homology.
+ *
+ * \implements PersistentHomology
+ *
+ * \tparam FilteredComplex must be a model of `FilteredComplex`.
+ */
+template<class FilteredComplex>
+class Persistent_homology_reduction {
+ public:
+  typedef FilteredComplex Filtered_complex;
+  typedef Field_Zp Coefficient_field;
+  /** \brief Data stored for each simplex. */
+  typedef typename FilteredComplex::Simplex_key Simplex_key;
+  /** \brief Handle to specify a simplex. */
+  typedef typename FilteredComplex::Simplex_handle Simplex_handle;
+  /** \brief Type for the value of the filtration function. */
+  typedef typename FilteredComplex::Filtration_value Filtration_value;
+  /** \brief Type of element of the field. */
+  typedef typename Coefficient_field::Element Arith_element;
+  /** \brief Type for birth and death FilteredComplex::Simplex_handle.
+   * The Arith_element field is the characteristic of the coefficient field. */
+  typedef std::tuple<Simplex_handle, Simplex_handle, Arith_element> Persistent_interval;
+
+  /** \brief Initializes the Persistent_homology_reduction class.
+   *
+   * The keys of the simplices of `cpx` are set to their position in the filtration.
+   *
+   * @param[in] cpx Complex for which the persistent homology is computed.
+   * cpx is a model of FilteredComplex
+   *
+   * @param[in] persistence_dim_max if true, the persistent homology for the maximal dimension in the
+   *                                complex is computed. If false, it is ignored. Default is false.
+   *
+   * @exception std::out_of_range In case the number of simplices is more than Simplex_key type numeric limit.
+   */
+  explicit Persistent_homology_reduction(FilteredComplex& cpx, bool persistence_dim_max = false)
+      : cpx_(&cpx),
+        dim_max_(cpx.dimension()),
+        num_simplices_(cpx.num_simplices()) {
+    if (num_simplices_ > static_cast<std::size_t>(std::numeric_limits<Simplex_key>::max())) {
+      // num_simplices must be strictly lower than the limit, because a value is reserved for null_key.
+      throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
+    }
+    Simplex_key idx_fil = 0;
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      cpx_->assign_key(sh, idx_fil);
+      ++idx_fil;
+    }
+    if (persistence_dim_max) {
+      ++dim_max_;
+    }
+  }
+
+  /** \brief Initializes the coefficient field \f$\mathbb{Z}/p\mathbb{Z}\f$, p must be prime. */
+  void init_coefficients(int charac) {
+    coeff_field_.init(charac);
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial complex.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   *
+   * Assumes that the filtration provided by the simplicial complex is
+   * valid. Undefined behavior otherwise. */
+  void compute_persistent_cohomology(Filtration_value min_interval_length = 0) {
+    persistent_pairs_.clear();
+    const Simplex_key null_key = cpx_->null_key();
+
+    // Sort the simplices by dimension, and by filtration inside a dimension.
+    std::vector<int> dims(num_simplices_);
+    int dim_cpx = 0;
+    for (std::size_t i = 0; i < num_simplices_; ++i) {
+      dims[i] = cpx_->dimension(cpx_->simplex(i));
+      dim_cpx = (std::max)(dim_cpx, dims[i]);
+    }
+    std::vector<std::size_t> dim_begin(dim_cpx + 2, 0);
+    for (int d : dims) ++dim_begin[d + 1];
+    for (int d = 1; d <= dim_cpx + 1; ++d) dim_begin[d] += dim_begin[d - 1];
+    std::vector<Simplex_key> order(num_simplices_);
+    {
+      std::vector<std::size_t> position(dim_begin.begin(), dim_begin.end() - 1);
+      for (std::size_t i = 0; i < num_simplices_; ++i) order[position[dims[i]]++] = i;
+    }
+
+    // Coboundaries of the simplices of dimension 1 to dim_cpx - 1, sorted by filtration, obtained by transposing the
+    // boundaries. The boundaries are enumerated once and their entries are first distributed in buckets of
+    // consecutive faces, that are then sorted independently, so that the transposition only writes to memory that is
+    // close in cache.
+    std::vector<std::vector<Bucket_entry>> buckets((num_simplices_ >> bucket_shift) + 1);
+    for (std::size_t t = dim_begin[std::min(2, dim_cpx + 1)]; t < num_simplices_; ++t) {
+      std::uint32_t sign = 0;
+      for (auto sh : cpx_->boundary_simplex_range(cpx_->simplex(order[t]))) {
+        Simplex_key face = cpx_->key(sh);
+        buckets[face >> bucket_shift].push_back(
+            Bucket_entry(order[t], static_cast<std::uint32_t>((face & bucket_mask) | sign)));
+        sign ^= negative_sign;
+      }
+    }
+    std::size_t num_entries = 0;
+    for (auto& bucket : buckets) num_entries += bucket.size();
+    coboundaries_.resize(num_entries);
+    coboundary_begin_.resize(num_simplices_ + 1);
+    const Arith_element one = coeff_field_.multiplicative_identity();
+    const Arith_element minus_one = coeff_field_.times_minus(one, one);
+    std::vector<std::size_t> position(bucket_mask + 1);
+    std::size_t begin = 0;
+    for (std::size_t b = 0; b < buckets.size(); ++b) {
+      std::fill(position.begin(), position.end(), 0);
+      for (const Bucket_entry& e : buckets[b]) ++position[e.face & bucket_mask];
+      for (std::size_t i = 0; i <= bucket_mask; ++i) {
+        std::size_t count = position[i];
+        position[i] = begin;
+        if ((b << bucket_shift) + i < num_simplices_) coboundary_begin_[(b << bucket_shift) + i] = begin;
+        begin += count;
+      }
+      // Cofaces were pushed in increasing order, and stay so
+      for (const Bucket_entry& e : buckets[b])
+        coboundaries_[position[e.face & bucket_mask]++] = Entry(e.coface, (e.face & negative_sign) ? minus_one : one);
+      std::vector<Bucket_entry>().swap(buckets[b]);
+    }
+    coboundary_begin_[num_simplices_] = begin;
+
+    // paired[i] is true if i is the birth or the death of a finite interval. pivot_column_[t] is the simplex whose
+    // reduced coboundary starts with t, column_begin_[s] is the position of the reduced coboundary of s in columns_.
+    std::vector<bool> paired(num_simplices_, false);
+    pivot_column_.assign(num_simplices_, null_key);
+    column_begin_.assign(num_simplices_, implicit_column);
+    columns_.clear();
+
+    // Dimension 0: union-find on the vertices, with the oldest vertex of each component.
+    std::vector<Simplex_key> parent(num_simplices_);
+    std::vector<Simplex_key> oldest(num_simplices_);
+    for (std::size_t i = 0; i < num_simplices_; ++i) parent[i] = oldest[i] = i;
+    auto find = [&parent](Simplex_key k) {
+      while (parent[k] != k) {
+        parent[k] = parent[parent[k]];
+        k = parent[k];
+      }
+      return k;
+    };
+    for (std::size_t e = dim_begin[1]; e < dim_begin[std::min(2, dim_cpx + 1)]; ++e) {
+      // An edge merges two connected components, and the younger one dies, with the same choice as
+      // Persistent_cohomology when both are born at the same time.
+      Simplex_handle sigma = cpx_->simplex(order[e]);
+      auto uv = cpx_->endpoints(sigma);
+      Simplex_key ru = find(cpx_->key(uv.first));
+      Simplex_key rv = find(cpx_->key(uv.second));
+      if (ru == rv) continue;
+      Simplex_key dying = oldest[rv];
+      if (!(cpx_->filtration(cpx_->simplex(oldest[ru])) < cpx_->filtration(cpx_->simplex(oldest[rv])))) {
+        dying = oldest[ru];
+        std::swap(ru, rv);
+      }
+      parent[rv] = ru;  // ru survives
+      paired[dying] = true;
+      paired[order[e]] = true;
+      if (cpx_->filtration(sigma) - cpx_->filtration(cpx_->simplex(dying)) > min_interval_length)
+        persistent_pairs_.emplace_back(cpx_->simplex(dying), sigma, coeff_field_.characteristic());
+    }
+
+    // Dimensions 1 to dim_cpx - 1: reduction of the coboundary matrix, by increasing dimension and decreasing
+    // filtration.
+    for (int d = 1; d < dim_cpx; ++d) {
+      for (std::size_t idx = dim_begin[d + 1]; idx-- > dim_begin[d];) {
+        Simplex_key s = order[idx];
+        // Clearing: the reduced coboundary of a simplex that was paired in dimension d - 1 is 0.
+        if (paired[s]) continue;
+        if (coboundary_begin_[s] == coboundary_begin_[s + 1]) continue;  // s is essential
+        Entry pivot = coboundaries_[coboundary_begin_[s]];
+        Simplex_key k = pivot_column_[pivot.row];
+        if (k != null_key) {
+          // The column needs to be reduced, it is enumerated lazily as a sum of coboundaries, given by reduction_.
+          reduction_.assign(1, Entry(s, one));
+          heap_.clear();
+          pivots_.clear();
+          push_coboundary(s, one);
+          bool found = pop_pivot(pivot);
+          while (found && (k = pivot_column_[pivot.row]) != null_key) {
+            add_column(k, coeff_field_.times_minus(pivot.coeff, coeff_field_.inverse(pivot_coefficient(k), 0).first));
+            found = pop_pivot(pivot);
+          }
+          if (!found) continue;  // s is essential
+          store_reduction(s, pivot.coeff);
+        }
+        // A column that was not modified is not stored, its coboundary is used instead.
+        pivot_column_[pivot.row] = s;
+        paired[s] = true;
+        paired[pivot.row] = true;
+        Simplex_handle birth = cpx_->simplex(s);
+        Simplex_handle death = cpx_->simplex(pivot.row);
+        if (cpx_->filtration(death) - cpx_->filtration(birth) > min_interval_length)
+          persistent_pairs_.emplace_back(birth, death, coeff_field_.characteristic());
+      }
+    }
+
+    // Essential classes. Like Persistent_cohomology, connected components are always reported.
+    for (std::size_t i = 0; i < num_simplices_; ++i) {
+      if (!paired[i] && (dims[i] == 0 || dims[i] < dim_max_))
+        persistent_pairs_.emplace_back(cpx_->simplex(i), cpx_->null_simplex(), coeff_field_.characteristic());
+    }
+
+    // Release the reduction data
+    std::vector<Entry>().swap(coboundaries_);
+    std::vector<Entry>().swap(columns_);
+    std::vector<std::size_t>().swap(coboundary_begin_);
+    std::vector<std::size_t>().swap(column_begin_);
+    std::vector<Simplex_key>().swap(pivot_column_);
+    std::vector<Entry>().swap(reduction_);
+    pivots_.clear();
+  }
+
+ private:
+  static const std::size_t implicit_column = static_cast<std::size_t>(-1);
+  // Faces are distributed in buckets of 2^bucket_shift for the transposition of the boundaries.
+  static const int bucket_shift = 16;
+  static const std::size_t bucket_mask = (std::size_t(1) << bucket_shift) - 1;
+  static const std::uint32_t negative_sign = std::uint32_t(1) << 31;
+
+  /* Coface of a face, whose position in its bucket is stored in the lower bits of face, and the sign in its coboundary
+   * in the highest bit. */
+  struct Bucket_entry {
+    Bucket_entry(Simplex_key c, std::uint32_t f) : coface(c), face(f) { }
+    Simplex_key coface;
+    std::uint32_t face;
+  };
+
+  /* Entry of a sparse column. Columns are sorted by increasing row. */
+  struct Entry {
+    Entry() { }
+    Entry(Simplex_key r, Arith_element c) : row(r), coeff(c) { }
+    Simplex_key row;
+    Arith_element coeff;
+  };
+
+  /* Cursor on a coboundary, multiplied by a coefficient, for the lazy enumeration of a sum of coboundaries. */
+  struct Cursor {
+    Cursor(const Entry* f, const Entry* l, Arith_element m) : first(f), last(l), mult(m) { }
+    const Entry* first;
+    const Entry* last;
+    Arith_element mult;
+  };
+
+  /* Order of the cursors in the min-heap heap_. */
+  struct cmp_cursors {
+    bool operator()(const Cursor& a, const Cursor& b) const {
+      return a.first->row > b.first->row;
+    }
+  };
+
+  /* Adds x * coboundary of k to the column being reduced. */
+  void push_coboundary(Simplex_key k, Arith_element x) {
+    heap_.emplace_back(coboundaries_.data() + coboundary_begin_[k], coboundaries_.data() + coboundary_begin_[k + 1], x);
+    std::push_heap(heap_.begin(), heap_.end(), cmp_cursors());
+  }
+
+  /* Adds x * (reduced coboundary of k) to the column being reduced. */
+  void add_column(Simplex_key k, Arith_element x) {
+    if (column_begin_[k] == implicit_column) {
+      reduction_.emplace_back(k, x);
+      push_coboundary(k, x);
+      return;
+    }
+    const Entry* first = columns_.data() + column_begin_[k] + 1;
+    const Entry* last = first + columns_[column_begin_[k]].row;
+    for (; first != last; ++first) {
+      Arith_element y = coeff_field_.times(first->coeff, x);
+      reduction_.emplace_back(first->row, y);
+      push_coboundary(first->row, y);
+    }
+  }
+
+  /* Finds the first non-zero entry of the column being reduced. The entries before it are consumed, and the pivot is
+   * pushed back as a single entry so that it cancels with the next column addition. */
+  bool pop_pivot(Entry& pivot) {
+    while (!heap_.empty()) {
+      Simplex_key row = heap_.front().first->row;
+      Arith_element c = coeff_field_.additive_identity();
+      do {
+        std::pop_heap(heap_.begin(), heap_.end(), cmp_cursors());
+        Cursor& cursor = heap_.back();
+        c = coeff_field_.plus_times_equal(c, cursor.first->coeff, cursor.mult);
+        if (++cursor.first == cursor.last) {
+          heap_.pop_back();
+        } else {
+          std::push_heap(heap_.begin(), heap_.end(), cmp_cursors());
+        }
+      } while (!heap_.empty() && heap_.front().first->row == row);
+      if (c != coeff_field_.additive_identity()) {
+        pivot = Entry(row, c);
+        pivots_.push_back(pivot);
+        heap_.emplace_back(&pivots_.back(), &pivots_.back() + 1, coeff_field_.multiplicative_identity());
+        std::push_heap(heap_.begin(), heap_.end(), cmp_cursors());
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /* Stores reduction_, with duplicates merged, as the reduced column of s with pivot coefficient c. */
+  void store_reduction(Simplex_key s, Arith_element c) {
+    std::sort(reduction_.begin(), reduction_.end(), [](const Entry& a, const Entry& b) { return a.row < b.row; });
+    column_begin_[s] = columns_.size();
+    columns_.push_back(Entry(0, c));
+    for (auto it = reduction_.begin(); it != reduction_.end();) {
+      Simplex_key k = it->row;
+      Arith_element x = coeff_field_.additive_identity();
+      for (; it != reduction_.end() && it->row == k; ++it) x = coeff_field_.plus_equal(x, it->coeff);
+      if (x != coeff_field_.additive_identity()) columns_.push_back(Entry(k, x));
+    }
+    columns_[column_begin_[s]].row = static_cast<Simplex_key>(columns_.size() - column_begin_[s] - 1);
+  }
+
+  /* Coefficient of the pivot of the reduced coboundary of k. */
+  Arith_element pivot_coefficient(Simplex_key k) const {
+    if (column_begin_[k] == implicit_column) return coboundaries_[coboundary_begin_[k]].coeff;
+    return columns_[column_begin_[k]].coeff;
+  }
+
+  /*
+   * Compare two intervals by length.
+   */
+  struct cmp_intervals_by_length {
+    explicit cmp_intervals_by_length(FilteredComplex * sc)
+        : sc_(sc) {
+    }
+    bool operator()(const Persistent_interval & p1, const Persistent_interval & p2) {
+      return (sc_->filtration(std::get<1>(p1)) - sc_->filtration(std::get<0>(p1))
+          > sc_->filtration(std::get<1>(p2)) - sc_->filtration(std::get<0>(p2)));
+    }
+    FilteredComplex * sc_;
+  };
+
+ public:
+  /** \brief Output the persistence diagram in ostream, in the format of `Persistent_cohomology::output_diagram()`.
+   */
+  void output_diagram(std::ostream& ostream = std::cout) {
+    cmp_intervals_by_length cmp(cpx_);
+    std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_), cmp);
+    bool has_infinity = std::numeric_limits<Filtration_value>::has_infinity;
+    for (auto pair : persistent_pairs_) {
+      if (has_infinity && cpx_->filtration(std::get<1>(pair)) == std::numeric_limits<Filtration_value>::infinity()) {
+        ostream << std::get<2>(pair) << "  " << cpx_->dimension(std::get<0>(pair)) << " "
+          << cpx_->filtration(std::get<0>(pair)) << " inf " << std::endl;
+      } else {
+        ostream << std::get<2>(pair) << "  " << cpx_->dimension(std::get<0>(pair)) << " "
+          << cpx_->filtration(std::get<0>(pair)) << " "
+          << cpx_->filtration(std::get<1>(pair)) << " " << std::endl;
+      }
+    }
+  }
+
+  /** \brief Output the persistence diagram in a file, in the format of
+   * `Persistent_cohomology::write_output_diagram()`. */
+  void write_output_diagram(std::string diagram_name) {
+    std::ofstream diagram_out(diagram_name.c_str());
+    cmp_intervals_by_length cmp(cpx_);
+    std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_), cmp);
+    bool has_infinity = std::numeric_limits<Filtration_value>::has_infinity;
+    for (auto pair : persistent_pairs_) {
+      if (has_infinity && cpx_->filtration(std::get<1>(pair)) == std::numeric_limits<Filtration_value>::infinity()) {
+        diagram_out << cpx_->dimension(std::get<0>(pair)) << " "
+              << cpx_->filtration(std::get<0>(pair)) << " inf" << std::endl;
+      } else {
+        diagram_out << cpx_->dimension(std::get<0>(pair)) << " "
+              << cpx_->filtration(std::get<0>(pair)) << " "
+              << cpx_->filtration(std::get<1>(pair)) << std::endl;
+      }
+    }
+  }
+
+  /** @brief Returns Betti numbers.
+   * @return A vector of Betti numbers.
+   */
+  std::vector<int> betti_numbers() const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto pair : persistent_pairs_) {
+      if (cpx_->null_simplex() == std::get<1>(pair)) {
+        betti_numbers[cpx_->dimension(std::get<0>(pair))] += 1;
+      }
+    }
+    return betti_numbers;
+  }
+
+  /** @brief Returns the persistent Betti numbers.
+   * @param[in] from The persistence birth limit to be added in the number \f$(persistent birth \leq from)\f$.
+   * @param[in] to The persistence death limit to be added in the number  \f$(persistent death > to)\f$.
+   * @return A vector of persistent Betti numbers.
+   */
+  std::vector<int> persistent_betti_numbers(Filtration_value from, Filtration_value to) const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto pair : persistent_pairs_) {
+      if (cpx_->filtration(std::get<0>(pair)) <= from &&
+          (std::get<1>(pair) == cpx_->null_simplex() || cpx_->filtration(std::get<1>(pair)) > to)) {
+        betti_numbers[cpx_->dimension(std::get<0>(pair))] += 1;
+      }
+    }
+    return betti_numbers;
+  }
+
+  /** @brief Returns a list of persistence birth and death FilteredComplex::Simplex_handle pairs.
+   * @return A list of Persistent_homology_reduction::Persistent_interval
+   */
+  const std::vector<Persistent_interval>& get_persistent_pairs() const {
+    return persistent_pairs_;
+  }
+
+  /** @brief Returns persistence intervals for a given dimension.
+   * @param[in] dimension Dimension to get the birth and death pairs from.
+   * @return A vector of persistence intervals (birth and death) on a fixed dimension.
+   */
+  std::vector< std::pair< Filtration_value , Filtration_value > >
+  intervals_in_dimension(int dimension) {
+    std::vector< std::pair< Filtration_value , Filtration_value > > result;
+    for (auto && pair : persistent_pairs_) {
+      if (cpx_->dimension(std::get<0>(pair)) == dimension) {
+        result.emplace_back(cpx_->filtration(std::get<0>(pair)), cpx_->filtration(std::get<1>(pair)));
+      }
+    }
+    return result;
+  }
+
+ private:
+  FilteredComplex * cpx_;
+  int dim_max_;
+  std::size_t num_simplices_;
+  Coefficient_field coeff_field_;
+  std::vector<Persistent_interval> persistent_pairs_;
+  // Coboundaries in compressed sparse row form.
+  std::vector<std::size_t> coboundary_begin_;
+  std::vector<Entry> coboundaries_;
+  // Reduction state: first entry -> column, column -> position in columns_.
+  std::vector<Simplex_key> pivot_column_;
+  std::vector<std::size_t> column_begin_;
+  // Stored reduced columns, as linear combinations of coboundaries, each one preceded by an entry whose row is its
+  // size and whose coefficient is the coefficient of its pivot.
+  std::vector<Entry> columns_;
+  // Column being reduced: linear combination of coboundaries and heap of cursors on them.
+  std::vector<Entry> reduction_;
+  std::vector<Cursor> heap_;
+  std::deque<Entry> pivots_;
+};
+
+template<class FilteredComplex>
+const std::size_t Persistent_homology_reduction<FilteredComplex>::implicit_column;
+template<class FilteredComplex>
+const std::size_t Persistent_homology_reduction<FilteredComplex>::bucket_mask;
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_HOMOLOGY_REDUCTION_H_
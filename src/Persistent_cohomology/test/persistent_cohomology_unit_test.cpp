@@ -5,6 +5,9 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <cstdint>  // for std::uint8_t
+#include <vector>
+#include <tuple>
+#include <sstream>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "persistent_cohomology"
@@ -14,6 +17,7 @@
 #include <gudhi/reader_utils.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Flat_filtered_complex.h>
 
 using namespace Gudhi;
 using namespace Gudhi::persistent_cohomology;
@@ -210,3 +214,152 @@ BOOST_AUTO_TEST_CASE( persistence_constructor_exception )
   BOOST_CHECK_THROW(Mini_st_persistence pcoh2(st), std::out_of_range);
 
 }
+
+BOOST_AUTO_TEST_CASE( flat_filtered_complex_persistence )
+{
+  typeST st;
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  using Flat_complex = Flat_filtered_complex<typeST::Filtration_value, typeST::Simplex_key, typeST::Vertex_handle>;
+  Flat_complex flat(st);
+
+  BOOST_CHECK(flat.num_simplices() == st.num_simplices());
+  BOOST_CHECK(flat.num_vertices() == st.num_vertices());
+  BOOST_CHECK(flat.dimension() == st.dimension());
+  for (auto sh : st.filtration_simplex_range()) {
+    Flat_complex::Simplex_handle fsh = flat.simplex(st.key(sh));
+    BOOST_CHECK(flat.filtration(fsh) == st.filtration(sh));
+    BOOST_CHECK(flat.dimension(fsh) == st.dimension(sh));
+    std::vector<typeST::Vertex_handle> st_vertices(st.simplex_vertex_range(sh).begin(),
+                                                   st.simplex_vertex_range(sh).end());
+    BOOST_CHECK(flat.simplex_vertex_range(fsh) == st_vertices);
+    std::vector<Flat_complex::Simplex_handle> st_boundary;
+    for (auto b_sh : st.boundary_simplex_range(sh)) st_boundary.push_back(st.key(b_sh));
+    std::vector<Flat_complex::Simplex_handle> flat_boundary(flat.boundary_simplex_range(fsh).begin(),
+                                                            flat.boundary_simplex_range(fsh).end());
+    BOOST_CHECK(flat_boundary == st_boundary);
+  }
+
+  for (int coefficient : {2, 3, 5}) {
+    Persistent_cohomology<typeST, Field_Zp> st_pcoh(st);
+    st_pcoh.init_coefficients(coefficient);
+    st_pcoh.compute_persistent_cohomology(0);
+    std::ostringstream st_diagram;
+    st_pcoh.output_diagram(st_diagram);
+
+    Persistent_cohomology<Flat_complex, Field_Zp> flat_pcoh(flat);
+    flat_pcoh.init_coefficients(coefficient);
+    flat_pcoh.compute_persistent_cohomology(0);
+    std::ostringstream flat_diagram;
+    flat_pcoh.output_diagram(flat_diagram);
+
+    std::cout << "flat_diagram=" << flat_diagram.str() << std::endl;
+    BOOST_CHECK(flat_diagram.str() == st_diagram.str());
+    for (int dim = 0; dim <= 3; ++dim)
+      BOOST_CHECK(flat_pcoh.persistent_betti_number(dim, 0.5, 1.0) == st_pcoh.persistent_betti_number(dim, 0.5, 1.0));
+  }
+
+  // Empty complex
+  typeST empty_st;
+  Flat_complex empty_flat(empty_st);
+  BOOST_CHECK(empty_flat.num_simplices() == 0);
+  BOOST_CHECK(empty_flat.num_vertices() == 0);
+  BOOST_CHECK(empty_flat.dimension() == -1);
+}
+
+BOOST_AUTO_TEST_CASE( persistence_memory_statistics )
+{
+  typeST st;
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  Persistent_cohomology<typeST, Field_Zp> pcoh(st);
+  BOOST_CHECK(pcoh.memory_statistics().cell_allocations == 0);
+  BOOST_CHECK(pcoh.memory_statistics().peak_matrix_bytes == 0);
+  pcoh.init_coefficients(3);
+  pcoh.compute_persistent_cohomology(0);
+
+  auto statistics = pcoh.memory_statistics();
+  std::cout << "cells=" << statistics.cell_allocations << " - columns=" << statistics.column_allocations
+      << " - rows=" << statistics.row_allocations << " - matrix bytes=" << statistics.matrix_bytes
+      << " - peak matrix bytes=" << statistics.peak_matrix_bytes << " - array bytes=" << statistics.array_bytes
+      << std::endl;
+  // Each cocycle creation allocates a cell, a column and a row
+  BOOST_CHECK(statistics.row_allocations > 0);
+  BOOST_CHECK(statistics.column_allocations >= statistics.row_allocations);
+  BOOST_CHECK(statistics.cell_allocations >= statistics.column_allocations);
+  BOOST_CHECK(statistics.peak_matrix_bytes >= statistics.matrix_bytes);
+  BOOST_CHECK(statistics.peak_matrix_bytes > 0);
+  BOOST_CHECK(statistics.array_bytes >= st.num_simplices() * (sizeof(int) + sizeof(typeST::Simplex_key)));
+}
+
+BOOST_AUTO_TEST_CASE( persistence_sinks )
+{
+  typeST st;
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (double min_persistence : {0., 0.3}) {
+    Persistent_cohomology<typeST, Field_Zp> pcoh(st);
+    pcoh.init_coefficients(3);
+    pcoh.compute_persistent_cohomology(min_persistence);
+    // output_diagram sorts the intervals
+    auto expected = pcoh.get_persistent_pairs();
+    std::ostringstream diagram;
+    pcoh.output_diagram(diagram);
+
+    // The sink receives the same intervals, in the same order, and nothing is stored
+    std::vector<Persistent_cohomology<typeST, Field_Zp>::Persistent_interval> pairs;
+    Persistent_cohomology<typeST, Field_Zp> pcoh_sink(st);
+    pcoh_sink.init_coefficients(3);
+    pcoh_sink.compute_persistent_cohomology([&](typeST::Simplex_handle birth, typeST::Simplex_handle death, int dim,
+                                                int charac) {
+      BOOST_CHECK(dim == st.dimension(birth));
+      pairs.emplace_back(birth, death, charac);
+    }, min_persistence);
+    BOOST_CHECK(pcoh_sink.get_persistent_pairs().empty());
+    BOOST_CHECK(pairs == expected);
+
+    // Text sink: the lines of output_diagram, in computation order
+    Persistent_cohomology<typeST, Field_Zp> pcoh_text(st);
+    pcoh_text.init_coefficients(3);
+    std::ostringstream text;
+    Persistence_text_sink<typeST> text_sink(st, text);
+    pcoh_text.compute_persistent_cohomology(text_sink, min_persistence);
+    auto sorted_lines = [](const std::string& str) {
+      std::istringstream stream(str);
+      std::vector<std::string> lines;
+      for (std::string line; std::getline(stream, line);) lines.push_back(line);
+      std::sort(lines.begin(), lines.end());
+      return lines;
+    };
+    BOOST_CHECK(sorted_lines(text.str()) == sorted_lines(diagram.str()));
+
+    // Binary sink
+    Persistent_cohomology<typeST, Field_Zp> pcoh_binary(st);
+    pcoh_binary.init_coefficients(3);
+    std::stringstream binary(std::ios::in | std::ios::out | std::ios::binary);
+    pcoh_binary.compute_persistent_cohomology(Persistence_binary_sink<typeST>(st, binary), min_persistence);
+    auto read_diagram = read_persistence_binary_diagram<typeST::Filtration_value>(binary);
+    BOOST_CHECK(read_diagram.size() == pairs.size());
+    for (std::size_t i = 0; i < read_diagram.size(); ++i) {
+      BOOST_CHECK(std::get<0>(read_diagram[i]) == st.dimension(std::get<0>(pairs[i])));
+      BOOST_CHECK(std::get<1>(read_diagram[i]) == st.filtration(std::get<0>(pairs[i])));
+      BOOST_CHECK(std::get<2>(read_diagram[i]) == st.filtration(std::get<1>(pairs[i])));
+    }
+    // The type tag rejects a diagram read with another Filtration_value
+    binary.clear();
+    binary.seekg(0);
+    BOOST_CHECK_THROW(read_persistence_binary_diagram<float>(binary), std::invalid_argument);
+  }
+
+  std::istringstream not_a_diagram("GUDHI");
+  BOOST_CHECK_THROW(read_persistence_binary_diagram<double>(not_a_diagram), std::invalid_argument);
+}
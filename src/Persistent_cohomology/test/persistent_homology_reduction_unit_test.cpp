@@ -0,0 +1,149 @@
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <utility> // std::pair
+#include <vector>
+#include <tuple>
+#include <random>
+#include <cstdint>  // for std::uint8_t
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "persistent_homology_reduction"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Flat_filtered_complex.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistent_homology_reduction.h>
+
+using namespace Gudhi;
+using namespace Gudhi::persistent_cohomology;
+
+typedef Simplex_tree<> typeST;
+typedef Flat_filtered_complex<typeST::Filtration_value, typeST::Simplex_key, typeST::Vertex_handle> Flat_complex;
+
+template<class Persistence>
+std::vector<std::pair<double, double>> sorted_intervals(Persistence& pers, int dim) {
+  auto intervals = pers.intervals_in_dimension(dim);
+  std::vector<std::pair<double, double>> result(intervals.begin(), intervals.end());
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+template<class Persistence>
+std::vector<std::tuple<Flat_complex::Simplex_handle, Flat_complex::Simplex_handle, int>>
+sorted_pairs(Persistence& pers) {
+  auto pairs = pers.get_persistent_pairs();
+  std::vector<std::tuple<Flat_complex::Simplex_handle, Flat_complex::Simplex_handle, int>> result(pairs.begin(),
+                                                                                                   pairs.end());
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+// Compare the reduction with Persistent_cohomology, on the Simplex_tree and on its flat version.
+void compare_with_persistent_cohomology(typeST& st, int coefficient, double min_persistence) {
+  st.initialize_filtration();
+  Flat_complex flat(st);
+
+  Persistent_cohomology<Flat_complex, Field_Zp> pcoh(flat);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology(min_persistence);
+
+  Persistent_homology_reduction<Flat_complex> flat_reduction(flat);
+  flat_reduction.init_coefficients(coefficient);
+  flat_reduction.compute_persistent_cohomology(min_persistence);
+
+  Persistent_homology_reduction<typeST> st_reduction(st);
+  st_reduction.init_coefficients(coefficient);
+  st_reduction.compute_persistent_cohomology(min_persistence);
+
+  // Pairs of simplices are unique for a given filtration order
+  BOOST_CHECK(sorted_pairs(flat_reduction) == sorted_pairs(pcoh));
+  for (int dim = 0; dim <= st.dimension(); ++dim) {
+    BOOST_CHECK(sorted_intervals(flat_reduction, dim) == sorted_intervals(pcoh, dim));
+    BOOST_CHECK(sorted_intervals(st_reduction, dim) == sorted_intervals(pcoh, dim));
+  }
+  BOOST_CHECK(flat_reduction.betti_numbers() == pcoh.betti_numbers());
+  BOOST_CHECK(st_reduction.persistent_betti_numbers(0.5, 1.) == pcoh.persistent_betti_numbers(0.5, 1.));
+
+  std::ostringstream pcoh_diagram;
+  pcoh.output_diagram(pcoh_diagram);
+  std::ostringstream reduction_diagram;
+  flat_reduction.output_diagram(reduction_diagram);
+  BOOST_CHECK(reduction_diagram.str().size() == pcoh_diagram.str().size());
+}
+
+BOOST_AUTO_TEST_CASE( persistent_homology_reduction_from_file )
+{
+  // file is copied in CMakeLists.txt
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  BOOST_CHECK(st.num_simplices() == 98);
+
+  for (int coefficient : {2, 3, 11}) {
+    compare_with_persistent_cohomology(st, coefficient, 0.);
+    compare_with_persistent_cohomology(st, coefficient, 0.3);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( persistent_homology_reduction_rips )
+{
+  std::mt19937 gen(12);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  for (int dim_max : {1, 2, 3, 4}) {
+    std::vector<std::vector<double>> points(40, std::vector<double>(3));
+    for (auto& p : points)
+      for (auto& x : p) x = coord(gen);
+    rips_complex::Rips_complex<double> rips(points, 0.6, Euclidean_distance());
+    typeST st;
+    rips.create_complex(st, dim_max);
+    std::cout << "Rips complex of dimension " << st.dimension() << " with " << st.num_simplices() << " simplices"
+        << std::endl;
+    for (int coefficient : {2, 3})
+      compare_with_persistent_cohomology(st, coefficient, 0.);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( persistent_homology_reduction_torsion )
+{
+  // Minimal triangulation of the real projective plane: H_1 is Z/2Z, so that H_1 and H_2 vanish in Z/3Z but not
+  // in Z/2Z.
+  typeST st;
+  const std::vector<std::vector<int>> triangles = {{0, 1, 3}, {0, 1, 4}, {0, 2, 3}, {0, 2, 5}, {0, 4, 5},
+                                                   {1, 2, 4}, {1, 2, 5}, {1, 3, 5}, {2, 3, 4}, {3, 4, 5}};
+  for (auto& triangle : triangles) st.insert_simplex_and_subfaces(triangle);
+  BOOST_CHECK(st.num_simplices() == 6 + 15 + 10);
+
+  st.initialize_filtration();
+  Persistent_homology_reduction<typeST> reduction(st, true);
+  reduction.init_coefficients(2);
+  reduction.compute_persistent_cohomology();
+  BOOST_CHECK(reduction.betti_numbers() == std::vector<int>({1, 1, 1}));
+  reduction.init_coefficients(3);
+  reduction.compute_persistent_cohomology();
+  BOOST_CHECK(reduction.betti_numbers() == std::vector<int>({1, 0, 0}));
+
+  for (int coefficient : {2, 3})
+    compare_with_persistent_cohomology(st, coefficient, 0.);
+}
+
+BOOST_AUTO_TEST_CASE( persistent_homology_reduction_exception )
+{
+  struct MiniSTOptions : Simplex_tree_options_full_featured {
+    typedef std::uint8_t Simplex_key;
+  };
+  Simplex_tree<MiniSTOptions> st;
+  const int simplex_0[] = {0, 1, 2, 3, 4, 5, 6, 7};
+  st.insert_simplex_and_subfaces(simplex_0);
+  st.initialize_filtration();
+  BOOST_CHECK_NO_THROW(Persistent_homology_reduction<Simplex_tree<MiniSTOptions>> reduction(st));
+
+  st.insert_simplex({8});
+  BOOST_CHECK_THROW(Persistent_homology_reduction<Simplex_tree<MiniSTOptions>> reduction(st), std::out_of_range);
+}
@@ -104,6 +104,15 @@ namespace rips_complex {
  * number of higher-dimensional simplices may not be monotonous when
  * \f$\frac12\leq\epsilon\leq 1\f$.
  *
+ * \section implicitrips Implicit Rips complex
+ *
+ * When the Rips complex is only built to compute its persistent homology, `Implicit_rips_complex` avoids the
+ * `Simplex_tree`: it only stores the graph, and for each simplex its index in the combinatorial number system and its
+ * dimension. It is a model of `FilteredComplex`, that is given directly to
+ * `Gudhi::persistent_cohomology::Persistent_cohomology`, and the filtration values, boundaries and vertices of the
+ * simplices are computed on demand from the graph. The utilities `rips_persistence` and
+ * `rips_distance_matrix_persistence` use it with the option `--implicit-complex`.
+ *
  * \section ripspointsdistance Point cloud and distance function
  * 
  * \subsection ripspointscloudexample Example from a point cloud and a distance function
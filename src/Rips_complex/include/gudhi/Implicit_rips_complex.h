@@ -0,0 +1,545 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef IMPLICIT_RIPS_COMPLEX_H_
+#define IMPLICIT_RIPS_COMPLEX_H_
+
+#include <gudhi/Simplex_tree/indexing_tag.h>
+#include <gudhi/Debug_utils.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/container/static_vector.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
+#include <tuple>
+#include <algorithm>  // for std::stable_sort, std::lower_bound
+#include <functional>  // for std::greater
+#include <limits>  // for std::numeric_limits
+#include <utility>  // for std::pair, std::make_pair
+#include <iterator>  // for std::begin, std::end
+#include <cstdint>  // for std::uint32_t, std::uint64_t, std::uint8_t
+#include <cstddef>  // for std::size_t
+#include <cmath>  // for std::pow
+#include <stdexcept>  // for std::out_of_range, std::invalid_argument
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Implicit_rips_complex
+ * \brief Rips complex that is a model of `FilteredComplex`, and that only stores its graph.
+ *
+ * \ingroup rips_complex
+ *
+ * \implements FilteredComplex
+ *
+ * \details
+ * The simplices of the Rips complex, up to a given dimension, are never stored in a `Simplex_tree`. They are
+ * enumerated from the graph of the edges of length less or equal to the threshold, so that the complex can be given
+ * directly to `Gudhi::persistent_cohomology::Persistent_cohomology`.
+ *
+ * A simplex is identified by its dimension \f$d\f$ and its index in the combinatorial number system,
+ * \f$\sum_{i=0}^{d} \binom{v_i}{d+1-i}\f$ where \f$v_0 > v_1 > \dots > v_d\f$ are its vertices. The edges are sorted
+ * by length, and the simplices whose longest edge is a given edge \f$e\f$ are enumerated from the cliques of the
+ * common neighbours of its vertices, which gives the filtration order. The complex stores the graph, and only the
+ * index (8 bytes) and the dimension (1 byte) of each simplex, in filtration order. The filtration values, the
+ * boundaries and the vertices of the simplices are computed on demand.
+ *
+ * A `Simplex_handle` is the position of the simplex in the filtration order. The key of a simplex is its
+ * `Simplex_handle`, which is what `Persistent_cohomology` assigns; the only other key that can be assigned is
+ * `null_key()`.
+ *
+ * \tparam FiltrationValue Type of the filtration values.
+ * \tparam SimplexKey Unsigned integer type of the keys and of the simplex handles. It must be able to represent the
+ * number of simplices.
+ */
+template<typename FiltrationValue, typename SimplexKey = std::uint32_t>
+class Implicit_rips_complex {
+ public:
+  /** \brief Bound on the dimension of the simplices, so that the boundaries are computed without allocation. */
+  static const int max_dimension = 63;
+
+  typedef FiltrationValue Filtration_value;
+  typedef SimplexKey Simplex_key;
+  typedef int Vertex_handle;
+  /** \brief Index of the simplex in the filtration order. */
+  typedef SimplexKey Simplex_handle;
+  typedef linear_indexing_tag Indexing_tag;
+
+  typedef boost::counting_iterator< Simplex_handle > Filtration_simplex_iterator;
+  typedef boost::iterator_range<Filtration_simplex_iterator> Filtration_simplex_range;
+  typedef Filtration_simplex_range Skeleton_simplex_range;
+
+  /** \brief Facets of a simplex, computed on demand. */
+  typedef boost::container::static_vector< Simplex_handle, max_dimension + 1 > Boundary_simplex_range;
+  /** \brief Vertices of a simplex, in decreasing order. */
+  typedef std::vector< Vertex_handle > Simplex_vertex_range;
+
+  /** \brief Edge of the graph, with its length. */
+  typedef std::tuple< Vertex_handle, Vertex_handle, Filtration_value > Edge;
+
+  /** \brief Implicit_rips_complex constructor from a list of points.
+   *
+   * @param[in] points Range of points.
+   * @param[in] threshold Rips value.
+   * @param[in] distance distance function that returns a `Filtration_value` from 2 given points.
+   * @param[in] dim_max maximal dimension of the simplices.
+   *
+   * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return input iterators on a
+   * point.
+   *
+   * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   *
+   * \exception std::out_of_range if the number of simplices can not be represented by `Simplex_key`, or the indices
+   * of the simplices on 64 bits.
+   */
+  template<typename ForwardPointRange, typename Distance>
+  Implicit_rips_complex(const ForwardPointRange& points, Filtration_value threshold, Distance distance, int dim_max) {
+    std::vector<Edge> edges;
+    Vertex_handle idx_u = 0;
+    for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
+      Vertex_handle idx_v = idx_u + 1;
+      for (auto it_v = it_u + 1; it_v != std::end(points); ++it_v, ++idx_v) {
+        Filtration_value fil = distance(*it_u, *it_v);
+        if (fil <= threshold) edges.emplace_back(idx_u, idx_v, fil);
+      }
+    }
+    init(idx_u, edges, dim_max);
+  }
+
+  /** \brief Implicit_rips_complex constructor from a distance matrix.
+   *
+   * @param[in] distance_matrix Range of distances.
+   * @param[in] threshold Rips value.
+   * @param[in] dim_max maximal dimension of the simplices.
+   *
+   * \tparam DistanceMatrix must have a `size()` method and on which `distance_matrix[i][j]` returns
+   * the distance between points \f$i\f$ and \f$j\f$ as long as \f$ 0 \leqslant j < i \leqslant
+   * distance\_matrix.size().\f$
+   *
+   * \exception std::out_of_range if the number of simplices can not be represented by `Simplex_key`, or the indices
+   * of the simplices on 64 bits.
+   */
+  template<typename DistanceMatrix>
+  Implicit_rips_complex(const DistanceMatrix& distance_matrix, Filtration_value threshold, int dim_max) {
+    std::vector<Edge> edges;
+    for (std::size_t i = 0; i < distance_matrix.size(); ++i) {
+      for (std::size_t j = 0; j < i; ++j) {
+        Filtration_value fil = distance_matrix[i][j];
+        if (fil <= threshold) edges.emplace_back(j, i, fil);
+      }
+    }
+    init(distance_matrix.size(), edges, dim_max);
+  }
+
+  /** \brief Implicit_rips_complex constructor from a list of edges.
+   *
+   * @param[in] num_vertices number of vertices, labeled from 0 to num_vertices - 1.
+   * @param[in] edges each edge once, as an `Edge`.
+   * @param[in] dim_max maximal dimension of the simplices.
+   *
+   * \exception std::out_of_range if the number of simplices can not be represented by `Simplex_key`, or the indices
+   * of the simplices on 64 bits.
+   */
+  Implicit_rips_complex(std::size_t num_vertices, std::vector<Edge> edges, int dim_max) {
+    init(num_vertices, edges, dim_max);
+  }
+
+  /** \brief Returns the number of simplices in the complex. */
+  std::size_t num_simplices() const {
+    return indices_.size();
+  }
+
+  /** \brief Returns the number of vertices in the complex. */
+  std::size_t num_vertices() const {
+    return num_vertices_;
+  }
+
+  /** \brief Returns the number of edges in the complex. */
+  std::size_t num_edges() const {
+    return edge_filtration_.size();
+  }
+
+  /** \brief Returns the dimension of the complex, -1 for an empty complex. */
+  int dimension() const {
+    return dim_cpx_;
+  }
+
+  /** \brief Returns the dimension of a simplex. */
+  int dimension(Simplex_handle sh) const {
+    return dims_[sh];
+  }
+
+  /** \brief Returns the range of all the simplices, in filtration order. */
+  Filtration_simplex_range filtration_simplex_range() const {
+    return Filtration_simplex_range(Filtration_simplex_iterator(0)
+                                    , Filtration_simplex_iterator(static_cast<Simplex_handle>(num_simplices())));
+  }
+
+  /** \brief Does nothing, simplices are already sorted by filtration. */
+  void initialize_filtration() const { }
+
+  /** \brief Returns the range of the vertices of the complex, which come first in the filtration order. Only
+   * `dim = 0` is supported. */
+  Skeleton_simplex_range skeleton_simplex_range(int dim = 0) const {
+    GUDHI_CHECK(dim == 0, std::invalid_argument("Implicit_rips_complex::skeleton_simplex_range - dimension must be 0"));
+    (void) dim;
+    return Skeleton_simplex_range(Filtration_simplex_iterator(0)
+                                  , Filtration_simplex_iterator(static_cast<Simplex_handle>(num_vertices_)));
+  }
+
+  /** \brief Returns the facets of a simplex. The i-th facet is the simplex without its i-th largest vertex. */
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) const {
+    Boundary_simplex_range boundary;
+    const int dim = dims_[sh];
+    if (dim == 0) return boundary;
+    Vertex_handle vertices[max_dimension + 1];
+    decode(indices_[sh], dim, vertices);
+    if (dim == 1) {
+      boundary.push_back(vertices[1]);
+      boundary.push_back(vertices[0]);
+      return boundary;
+    }
+    Simplex_key edges[max_dimension + 1][max_dimension + 1];
+    for (int i = 0; i <= dim; ++i)
+      for (int j = i + 1; j <= dim; ++j) edges[i][j] = edge_rank(vertices[i], vertices[j]);
+    for (int removed = 0; removed <= dim; ++removed) {
+      // Index of the facet, and its longest edge, which gives the block of simplices it belongs to
+      Index index = 0;
+      Simplex_key longest = 0;
+      for (int i = 0, pos = 0; i <= dim; ++i) {
+        if (i == removed) continue;
+        index += binomials_[dim - pos][vertices[i]];
+        ++pos;
+        for (int j = i + 1; j <= dim; ++j)
+          if (j != removed) longest = (std::max)(longest, edges[i][j]);
+      }
+      boundary.push_back(find(longest, dim - 1, index));
+    }
+    return boundary;
+  }
+
+  /** \brief Returns the two vertices of an edge. */
+  std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) const {
+    Vertex_handle vertices[2];
+    decode(indices_[sh], 1, vertices);
+    return std::pair<Simplex_handle, Simplex_handle>(vertices[0], vertices[1]);
+  }
+
+  /** \brief Returns the vertices of a simplex, in decreasing order. */
+  Simplex_vertex_range simplex_vertex_range(Simplex_handle sh) const {
+    Simplex_vertex_range vertices(dims_[sh] + 1);
+    decode(indices_[sh], dims_[sh], vertices.data());
+    return vertices;
+  }
+
+  /** \brief Returns the filtration value of a simplex, the length of its longest edge. */
+  Filtration_value filtration(Simplex_handle sh) const {
+    if (sh == null_simplex()) {
+      return std::numeric_limits<Filtration_value>::infinity();
+    }
+    if (sh < num_vertices_) return 0;
+    // Block of the longest edge of sh
+    auto it = std::upper_bound(block_begin_.begin(), block_begin_.end(), static_cast<std::size_t>(sh));
+    return edge_filtration_[it - block_begin_.begin() - 1];
+  }
+
+  Simplex_key key(Simplex_handle sh) const {
+    if (null_keys_[sh]) return null_key();
+    return sh;
+  }
+
+  /** \brief Assigns a key to a simplex, which must be either `sh` itself or `null_key()`. */
+  void assign_key(Simplex_handle sh, Simplex_key key) {
+    GUDHI_CHECK(key == sh || key == null_key(),
+                std::invalid_argument("Implicit_rips_complex::assign_key - the key must be sh or null_key()"));
+    null_keys_[sh] = (key == null_key());
+  }
+
+  static Simplex_key null_key() {
+    return static_cast<Simplex_key>(-1);
+  }
+
+  Simplex_handle simplex(Simplex_key key) const {
+    if (key == null_key()) return null_simplex();
+    return key;
+  }
+
+  static Simplex_handle null_simplex() {
+    return static_cast<Simplex_handle>(-1);
+  }
+
+  /** \brief Returns the number of bytes used by the arrays of the complex. */
+  std::size_t size_in_bytes() const {
+    return sizeof(*this)
+        + edge_filtration_.capacity() * sizeof(Filtration_value)
+        + edge_vertices_.capacity() * sizeof(std::pair<Vertex_handle, Vertex_handle>)
+        + neighbor_begin_.capacity() * sizeof(std::size_t)
+        + neighbors_.capacity() * sizeof(Neighbor)
+        + block_begin_.capacity() * sizeof(std::size_t)
+        + indices_.capacity() * sizeof(Index)
+        + dims_.capacity() * sizeof(std::uint8_t)
+        + null_keys_.capacity() / 8
+        + binomials_.size() * (num_vertices_ + 1) * sizeof(Index);
+  }
+
+ private:
+  typedef std::uint64_t Index;
+
+  struct Neighbor {
+    Vertex_handle vertex;
+    Simplex_key edge;
+  };
+
+  void init(std::size_t num_vertices, std::vector<Edge>& edges, int dim_max) {
+    num_vertices_ = num_vertices;
+    dim_max_ = (std::max)(0, (std::min)(dim_max, max_dimension));
+    if (num_vertices_ > 0) dim_max_ = (std::min)(dim_max_, static_cast<int>(num_vertices_) - 1);
+    // Edges are sorted by length, stable to keep the order of the input for equal lengths.
+    std::stable_sort(edges.begin(), edges.end(), [](const Edge& e1, const Edge& e2) {
+      return std::get<2>(e1) < std::get<2>(e2);
+    });
+    if (dim_max_ < 1) edges.clear();
+    if (num_vertices_ + edges.size() > static_cast<std::size_t>(null_key()))
+      throw std::out_of_range("Implicit_rips_complex - too many simplices for the Simplex_key type.");
+
+    // Graph, with the rank of each edge in the sorted order
+    edge_filtration_.resize(edges.size());
+    edge_vertices_.resize(edges.size());
+    neighbor_begin_.assign(num_vertices_ + 1, 0);
+    for (const Edge& edge : edges) {
+      ++neighbor_begin_[std::get<0>(edge) + 1];
+      ++neighbor_begin_[std::get<1>(edge) + 1];
+    }
+    for (std::size_t v = 0; v < num_vertices_; ++v) neighbor_begin_[v + 1] += neighbor_begin_[v];
+    neighbors_.resize(2 * edges.size());
+    {
+      std::vector<std::size_t> position(neighbor_begin_.begin(), neighbor_begin_.end() - 1);
+      for (std::size_t e = 0; e < edges.size(); ++e) {
+        Vertex_handle u = std::get<0>(edges[e]);
+        Vertex_handle v = std::get<1>(edges[e]);
+        edge_filtration_[e] = std::get<2>(edges[e]);
+        edge_vertices_[e] = std::make_pair(u, v);
+        neighbors_[position[u]++] = Neighbor{v, static_cast<Simplex_key>(e)};
+        neighbors_[position[v]++] = Neighbor{u, static_cast<Simplex_key>(e)};
+      }
+    }
+    for (std::size_t v = 0; v < num_vertices_; ++v)
+      std::sort(neighbors_.begin() + neighbor_begin_[v], neighbors_.begin() + neighbor_begin_[v + 1],
+                [](const Neighbor& n1, const Neighbor& n2) { return n1.vertex < n2.vertex; });
+    std::vector<Edge>().swap(edges);
+
+    // Simplices of each block, i.e. whose longest edge is a given edge: counted first, then enumerated in place.
+    const std::size_t num_edges = edge_filtration_.size();
+    std::vector<std::size_t> block_size(num_edges);
+    std::vector<int> block_dimension(num_edges, 1);
+    for_each_edge(num_edges, [&](std::size_t e) {
+      std::size_t count = 0;
+      int dim = 1;
+      enumerate_block(e, [&](int d, const std::vector<Vertex_handle>&) { ++count; dim = (std::max)(dim, d); });
+      block_size[e] = count;
+      block_dimension[e] = dim;
+    });
+    block_begin_.resize(num_edges + 1);
+    block_begin_[0] = num_vertices_;
+    dim_cpx_ = num_vertices_ > 0 ? 0 : -1;
+    for (std::size_t e = 0; e < num_edges; ++e) {
+      block_begin_[e + 1] = block_begin_[e] + block_size[e];
+      dim_cpx_ = (std::max)(dim_cpx_, block_dimension[e]);
+    }
+    std::vector<std::size_t>().swap(block_size);
+    std::vector<int>().swap(block_dimension);
+    // Indices are only needed up to the dimension of the complex, which can be much lower than dim_max.
+    dim_max_ = (std::max)(0, dim_cpx_);
+
+    // binomials_[k][v] = binomial(v, k), for the indices of the simplices of dimension k - 1
+    factorials_.assign(dim_max_ + 2, 1.);
+    for (int k = 1; k < dim_max_ + 2; ++k) factorials_[k] = factorials_[k - 1] * k;
+    binomials_.assign(dim_max_ + 2, std::vector<Index>(num_vertices_ + 1, 0));
+    for (int k = 0; k < static_cast<int>(binomials_.size()); ++k) {
+      for (std::size_t v = 0; v <= num_vertices_; ++v) {
+        if (k == 0) {
+          binomials_[k][v] = 1;
+        } else if (v > 0) {
+          Index sum = binomials_[k - 1][v - 1] + binomials_[k][v - 1];
+          if (sum < binomials_[k][v - 1])
+            throw std::out_of_range("Implicit_rips_complex - too many vertices to index the simplices on 64 bits.");
+          binomials_[k][v] = sum;
+        }
+      }
+    }
+
+    const std::size_t num_simp = block_begin_[num_edges];
+    // One value is reserved for null_key
+    if (num_simp > static_cast<std::size_t>(null_key()))
+      throw std::out_of_range("Implicit_rips_complex - too many simplices for the Simplex_key type.");
+
+    indices_.resize(num_simp);
+    dims_.resize(num_simp);
+    null_keys_.assign(num_simp, false);
+    for (std::size_t v = 0; v < num_vertices_; ++v) indices_[v] = v;
+    for_each_edge(num_edges, [&](std::size_t e) {
+      std::vector<std::pair<int, Index>> block;
+      block.reserve(block_begin_[e + 1] - block_begin_[e]);
+      enumerate_block(e, [&](int d, const std::vector<Vertex_handle>& clique) {
+        block.emplace_back(d, index_of(clique));
+      });
+      // Faces before cofaces
+      std::sort(block.begin(), block.end());
+      for (std::size_t i = 0; i < block.size(); ++i) {
+        dims_[block_begin_[e] + i] = static_cast<std::uint8_t>(block[i].first);
+        indices_[block_begin_[e] + i] = block[i].second;
+      }
+    });
+  }
+
+  template<class Function>
+  static void for_each_edge(std::size_t num_edges, const Function& f) {
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_edges, f);
+#else
+    for (std::size_t e = 0; e < num_edges; ++e) f(e);
+#endif
+  }
+
+  /* Calls f(dimension, vertices) for each simplex whose longest edge is e, i.e. e together with a clique of common
+   * neighbours of its vertices linked by edges that are all older than e. */
+  template<class Function>
+  void enumerate_block(std::size_t e, const Function& f) const {
+    const Vertex_handle u = edge_vertices_[e].first;
+    const Vertex_handle v = edge_vertices_[e].second;
+    std::vector<Vertex_handle> candidates;
+    auto it_u = neighbors_.begin() + neighbor_begin_[u];
+    auto end_u = neighbors_.begin() + neighbor_begin_[u + 1];
+    auto it_v = neighbors_.begin() + neighbor_begin_[v];
+    auto end_v = neighbors_.begin() + neighbor_begin_[v + 1];
+    while (it_u != end_u && it_v != end_v) {
+      if (it_u->vertex < it_v->vertex) {
+        ++it_u;
+      } else if (it_v->vertex < it_u->vertex) {
+        ++it_v;
+      } else {
+        if (it_u->edge < e && it_v->edge < e) candidates.push_back(it_u->vertex);
+        ++it_u;
+        ++it_v;
+      }
+    }
+    std::vector<Vertex_handle> clique = {u, v};
+    expand(e, clique, candidates, f);
+  }
+
+  template<class Function>
+  void expand(std::size_t e, std::vector<Vertex_handle>& clique, const std::vector<Vertex_handle>& candidates,
+              const Function& f) const {
+    const int dim = static_cast<int>(clique.size()) - 1;
+    f(dim, clique);
+    if (dim >= dim_max_) return;
+    std::vector<Vertex_handle> next_candidates;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+      clique.push_back(candidates[i]);
+      if (dim + 1 == dim_max_) {
+        // The cofaces of the new simplex are not in the complex
+        f(dim + 1, clique);
+      } else {
+        next_candidates.clear();
+        for (std::size_t j = i + 1; j < candidates.size(); ++j)
+          if (edge_rank(candidates[i], candidates[j]) < e) next_candidates.push_back(candidates[j]);
+        expand(e, clique, next_candidates, f);
+      }
+      clique.pop_back();
+    }
+  }
+
+  Index index_of(const std::vector<Vertex_handle>& clique) const {
+    Vertex_handle vertices[max_dimension + 1];
+    std::copy(clique.begin(), clique.end(), vertices);
+    const std::size_t k = clique.size();
+    std::sort(vertices, vertices + k, std::greater<Vertex_handle>());
+    Index index = 0;
+    for (std::size_t i = 0; i < k; ++i) index += binomials_[k - i][vertices[i]];
+    return index;
+  }
+
+  /* Vertices of the simplex of dimension dim and index index, in decreasing order. */
+  void decode(Index index, int dim, Vertex_handle* vertices) const {
+    std::size_t bound = num_vertices_;
+    for (int k = dim + 1; k >= 1; --k) {
+      // Largest vertex w < bound such that binomial(w, k) <= index, starting from the estimate
+      // binomial(w, k) ~ (w - (k - 1) / 2)^k / k!
+      const std::vector<Index>& binomials = binomials_[k];
+      std::size_t w = index;
+      if (k > 1) {
+        double estimate = std::pow(static_cast<double>(index) * factorials_[k], 1. / k) + (k - 1) / 2.;
+        w = static_cast<std::size_t>((std::max)(0., (std::min)(estimate, static_cast<double>(bound - 1))));
+        while (w + 1 < bound && binomials[w + 1] <= index) ++w;
+        while (binomials[w] > index) --w;
+      }
+      vertices[dim + 1 - k] = static_cast<Vertex_handle>(w);
+      index -= binomials[w];
+      bound = w;
+    }
+  }
+
+  /* Rank of the edge [u, v], null_key() if there is no such edge. */
+  Simplex_key edge_rank(Vertex_handle u, Vertex_handle v) const {
+    auto begin = neighbors_.begin() + neighbor_begin_[u];
+    auto end = neighbors_.begin() + neighbor_begin_[u + 1];
+    auto it = std::lower_bound(begin, end, v, [](const Neighbor& n, Vertex_handle w) { return n.vertex < w; });
+    if (it == end || it->vertex != v) return null_key();
+    return it->edge;
+  }
+
+  /* Simplex_handle of the simplex of dimension dim and index index, whose longest edge is e. */
+  Simplex_handle find(Simplex_key e, int dim, Index index) const {
+    // The edge itself comes first in its block
+    if (dim == 1) return static_cast<Simplex_handle>(block_begin_[e]);
+    std::size_t lo = block_begin_[e] + 1;
+    std::size_t hi = block_begin_[e + 1];
+    while (lo < hi) {
+      std::size_t mid = (lo + hi) / 2;
+      if (dims_[mid] < dim || (dims_[mid] == dim && indices_[mid] < index))
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    GUDHI_CHECK(lo < block_begin_[e + 1] && dims_[lo] == dim && indices_[lo] == index,
+                std::logic_error("Implicit_rips_complex::find - facet not found"));
+    return static_cast<Simplex_handle>(lo);
+  }
+
+  std::size_t num_vertices_;
+  int dim_max_;
+  int dim_cpx_;
+  // Graph: lengths and endpoints of the edges sorted by length, and neighbours of each vertex, sorted, with the rank of the edge.
+  std::vector<Filtration_value> edge_filtration_;
+  std::vector<std::pair<Vertex_handle, Vertex_handle>> edge_vertices_;
+  std::vector<std::size_t> neighbor_begin_;
+  std::vector<Neighbor> neighbors_;
+  // Simplices in filtration order: the vertices, then for each edge the block of simplices whose longest edge it is.
+  std::vector<std::size_t> block_begin_;
+  std::vector<Index> indices_;
+  std::vector<std::uint8_t> dims_;
+  std::vector<bool> null_keys_;
+  std::vector<std::vector<Index>> binomials_;
+  std::vector<double> factorials_;
+};
+
+template<typename FiltrationValue, typename SimplexKey>
+const int Implicit_rips_complex<FiltrationValue, SimplexKey>::max_dimension;
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // IMPLICIT_RIPS_COMPLEX_H_
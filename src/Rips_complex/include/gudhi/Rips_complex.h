@@ -17,6 +17,12 @@
 #include <gudhi/graph_simplicial_complex.h>
 
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/irange.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 #include <iostream>
 #include <vector>
@@ -24,12 +30,34 @@
 #include <string>
 #include <limits>  // for numeric_limits
 #include <utility>  // for pair<>
+#include <algorithm>  // for std::sort, std::lower_bound
+#include <iterator>  // for std::begin, std::distance
+#include <cmath>  // for std::floor, std::isfinite
+#include <cstdint>  // for std::int64_t
 
 
 namespace Gudhi {
 
 namespace rips_complex {
 
+/**
+ * \brief Tag to select the grid based proximity graph computation in the `Rips_complex` constructor from a list of
+ * points.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * Points are bucketed in a uniform grid of cell width the Rips threshold, built on (at most) the first 3 coordinates
+ * of the points. Only pairs of points lying in neighbouring cells are given to the distance function, and the work is
+ * spread across threads when GUDHI is compiled with TBB, in which case the distance function must be thread-safe. The
+ * resulting graph is identical to the one computed by the default constructor.
+ *
+ * The distance function must be bounded from below by the absolute difference of any of the coordinates, i.e.
+ * \f$ |p_k - q_k| \leqslant distance(p, q) \f$, which is the case for `Gudhi::Euclidean_distance` and any
+ * \f$ L_p \f$ norm.
+ */
+struct Grid_proximity_search {};
+
 /**
  * \class Rips_complex
  * \brief Rips complex data structure.
@@ -74,6 +102,28 @@ class Rips_complex {
     compute_proximity_graph(points, threshold, distance);
   }
 
+  /** \brief Rips_complex constructor from a list of points, with a proximity graph computed in parallel through a
+   * uniform grid.
+   *
+   * @param[in] points Range of points.
+   * @param[in] threshold Rips value.
+   * @param[in] distance distance function that returns a `Filtration_value` from 2 given points.
+   * 
+   * \tparam RandomAccessPointRange must be a random access range of points, where each point is a random access
+   * range of coordinates.
+   *
+   * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+   * `Point` is a point from the `RandomAccessPointRange`, and that returns a `Filtration_value`. It must satisfy the
+   * requirements detailed in `Grid_proximity_search`. When GUDHI is compiled with TBB, the same `distance` object is
+   * called concurrently from several threads, so its `operator()` must be thread-safe (e.g. not modify any shared
+   * state, like a cache or a counter, without synchronization).
+   */
+  template<typename RandomAccessPointRange, typename Distance >
+  Rips_complex(const RandomAccessPointRange& points, Filtration_value threshold, Distance distance,
+               Grid_proximity_search) {
+    compute_proximity_graph_with_grid(points, threshold, distance);
+  }
+
   /** \brief Rips_complex constructor from a distance matrix.
    *
    * @param[in] distance_matrix Range of distances.
@@ -110,6 +160,13 @@ class Rips_complex {
     complex.expansion(dim_max);
   }
 
+  /** \brief Returns the Rips graph, for instance to collapse its edges with
+   * `Gudhi::collapse::flag_complex_collapse_graph()` before inserting it in a simplicial complex.
+   */
+  const OneSkeletonGraph& one_skeleton_graph() const {
+    return rips_skeleton_graph_;
+  }
+
  private:
   /** \brief Computes the proximity graph of the points.
    *
@@ -145,14 +202,155 @@ class Rips_complex {
       }
     }
 
-    // --------------------------------------------------------------------------------------------
-    // Creates the proximity graph from edges and sets the property with the filtration value.
-    // Number of points is labeled from 0 to idx_u-1
-    // --------------------------------------------------------------------------------------------
+    init_graph(edges, edges_fil, idx_u);
+  }
+
+  /** \brief Computes the proximity graph of the points with the help of a uniform grid.
+   *
+   * Points are bucketed in cells of width `threshold` along (at most) `max_grid_dimension` coordinates. Two points at
+   * distance less or equal to `threshold` lie in neighbouring cells, so only those pairs are checked. Point indices are
+   * split in chunks that are processed in parallel, and the chunks edge lists are concatenated in order, so that the
+   * edges come in the same order as with `compute_proximity_graph`.
+   */
+  template< typename RandomAccessPointRange, typename Distance >
+  void compute_proximity_graph_with_grid(const RandomAccessPointRange& points, Filtration_value threshold,
+                                         Distance distance) {
+    typedef std::int64_t Cell_coordinate;
+    // The number of neighbouring cells grows as 3^max_grid_dimension
+    const std::size_t max_grid_dimension = 3;
+    // Number of consecutive points processed by a task
+    const std::size_t chunk_size = 256;
+
+    auto first = std::begin(points);
+    const std::size_t num_points = boost::size(points);
+    std::size_t ambient_dimension = 0;
+    if (num_points > 0)
+      ambient_dimension = std::distance(std::begin(first[0]), std::end(first[0]));
+
+    // Any positive width larger than threshold is valid. It is slightly enlarged to be robust to rounding errors.
+    double width = 1.;
+    if (threshold > 0) width = threshold * (1. + 1e-6);
+    std::vector<std::size_t> grid_axes;
+    std::vector<double> grid_origin;
+    if (std::isfinite(width)) {
+      for (std::size_t axis = 0; axis < ambient_dimension && grid_axes.size() < max_grid_dimension; ++axis) {
+        double mini = std::numeric_limits<double>::infinity();
+        double maxi = -std::numeric_limits<double>::infinity();
+        for (std::size_t idx = 0; idx < num_points; ++idx) {
+          double coord = std::begin(first[idx])[axis];
+          mini = (std::min)(mini, coord);
+          maxi = (std::max)(maxi, coord);
+        }
+        // Axes that would require too many cells (or with infinite coordinates) are not worth a grid axis
+        if ((maxi - mini) / width < 1e15) {
+          grid_axes.push_back(axis);
+          grid_origin.push_back(mini);
+        }
+      }
+    }
+    const std::size_t grid_dimension = grid_axes.size();
+
+    // Cell coordinates of every point, and points sorted by cell
+    std::vector<Cell_coordinate> point_cells(num_points * grid_dimension);
+    for (std::size_t idx = 0; idx < num_points; ++idx)
+      for (std::size_t k = 0; k < grid_dimension; ++k)
+        point_cells[idx * grid_dimension + k] = static_cast<Cell_coordinate>(
+            std::floor((std::begin(first[idx])[grid_axes[k]] - grid_origin[k]) / width));
+    auto cell_less = [&](const Cell_coordinate* c1, const Cell_coordinate* c2) {
+      return std::lexicographical_compare(c1, c1 + grid_dimension, c2, c2 + grid_dimension);
+    };
+    std::vector<Vertex_handle> sorted_points(num_points);
+    for (std::size_t idx = 0; idx < num_points; ++idx) sorted_points[idx] = idx;
+    std::sort(sorted_points.begin(), sorted_points.end(), [&](Vertex_handle u, Vertex_handle v) {
+      return cell_less(&point_cells[u * grid_dimension], &point_cells[v * grid_dimension]);
+    });
+    // Non-empty cells, in lexicographic order, with their range in sorted_points
+    std::vector<std::size_t> cell_begin;
+    for (std::size_t pos = 0; pos < num_points; ++pos) {
+      if (pos == 0 || cell_less(&point_cells[sorted_points[pos - 1] * grid_dimension],
+                                &point_cells[sorted_points[pos] * grid_dimension]))
+        cell_begin.push_back(pos);
+    }
+    cell_begin.push_back(num_points);
+    const std::size_t num_cells = cell_begin.size() - 1;
+
+    const std::size_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<std::pair<Vertex_handle, Vertex_handle>>> chunk_edges(num_chunks);
+    std::vector<std::vector<Filtration_value>> chunk_edges_fil(num_chunks);
+
+    auto process_chunk = [&](std::size_t chunk) {
+      std::vector<Cell_coordinate> neighbor_cell(grid_dimension);
+      std::vector<int> offset(grid_dimension);
+      std::vector<Vertex_handle> candidates;
+      const std::size_t last = (std::min)(num_points, (chunk + 1) * chunk_size);
+      for (std::size_t idx_u = chunk * chunk_size; idx_u < last; ++idx_u) {
+        candidates.clear();
+        const Cell_coordinate* u_cell = &point_cells[idx_u * grid_dimension];
+        // Enumerates the 3^grid_dimension offsets in {-1, 0, 1}^grid_dimension
+        std::fill(offset.begin(), offset.end(), -1);
+        while (true) {
+          for (std::size_t k = 0; k < grid_dimension; ++k) neighbor_cell[k] = u_cell[k] + offset[k];
+          // Binary search of the neighbouring cell among the non-empty ones
+          std::size_t lo = 0, hi = num_cells;
+          while (lo < hi) {
+            std::size_t mid = (lo + hi) / 2;
+            if (cell_less(&point_cells[sorted_points[cell_begin[mid]] * grid_dimension], neighbor_cell.data()))
+              lo = mid + 1;
+            else
+              hi = mid;
+          }
+          if (lo < num_cells && !cell_less(neighbor_cell.data(),
+                                           &point_cells[sorted_points[cell_begin[lo]] * grid_dimension])) {
+            for (std::size_t pos = cell_begin[lo]; pos < cell_begin[lo + 1]; ++pos)
+              if (sorted_points[pos] > static_cast<Vertex_handle>(idx_u)) candidates.push_back(sorted_points[pos]);
+          }
+          std::size_t k = 0;
+          while (k < grid_dimension && offset[k] == 1) offset[k++] = -1;
+          if (k == grid_dimension) break;
+          ++offset[k];
+        }
+        // Same order as in compute_proximity_graph
+        std::sort(candidates.begin(), candidates.end());
+        for (Vertex_handle idx_v : candidates) {
+          Filtration_value fil = distance(first[idx_u], first[idx_v]);
+          if (fil <= threshold) {
+            chunk_edges[chunk].emplace_back(idx_u, idx_v);
+            chunk_edges_fil[chunk].push_back(fil);
+          }
+        }
+      }
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_chunks, process_chunk);
+#else
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) process_chunk(chunk);
+#endif
+
+    std::size_t num_edges = 0;
+    for (auto& edges : chunk_edges) num_edges += edges.size();
+    std::vector< std::pair< Vertex_handle, Vertex_handle > > edges;
+    std::vector< Filtration_value > edges_fil;
+    edges.reserve(num_edges);
+    edges_fil.reserve(num_edges);
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      edges.insert(edges.end(), chunk_edges[chunk].begin(), chunk_edges[chunk].end());
+      edges_fil.insert(edges_fil.end(), chunk_edges_fil[chunk].begin(), chunk_edges_fil[chunk].end());
+      // Release memory as soon as possible
+      std::vector<std::pair<Vertex_handle, Vertex_handle>>().swap(chunk_edges[chunk]);
+      std::vector<Filtration_value>().swap(chunk_edges_fil[chunk]);
+    }
+    init_graph(edges, edges_fil, num_points);
+  }
+
+  /** \brief Creates the proximity graph from edges and sets the property with the filtration value.
+   * Points are labeled from 0 to num_points-1.
+   */
+  void init_graph(const std::vector< std::pair< Vertex_handle, Vertex_handle > >& edges,
+                  const std::vector< Filtration_value >& edges_fil, std::size_t num_points) {
     // Do not use : rips_skeleton_graph_ = OneSkeletonGraph(...) -> deep copy of the graph (boost graph is not
     // move-enabled)
     rips_skeleton_graph_.~OneSkeletonGraph();
-    new(&rips_skeleton_graph_)OneSkeletonGraph(edges.begin(), edges.end(), edges_fil.begin(), idx_u);
+    new(&rips_skeleton_graph_)OneSkeletonGraph(edges.begin(), edges.end(), edges_fil.begin(), num_points);
 
     auto vertex_prop = boost::get(vertex_filtration_t(), rips_skeleton_graph_);
 
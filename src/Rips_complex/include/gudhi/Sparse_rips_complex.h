@@ -129,6 +129,20 @@ class Sparse_rips_complex {
     complex.expansion_with_blockers(dim_max, block);
   }
 
+  /** \brief Type of the one skeleton graph returned by `one_skeleton_graph()`. */
+  typedef Graph OneSkeletonGraph;
+
+  /** \brief Returns the sparse Rips graph, for instance to collapse its edges with
+   * `Gudhi::collapse::flag_complex_collapse_graph()`.
+   *
+   * `create_complex()` only builds the flag complex of this graph when epsilon is at least 1. Otherwise, some cliques
+   * of the graph are blocked, and the flag complex of the collapsed graph has the persistence of the flag complex of
+   * the sparse Rips graph, not of the sparse Rips complex.
+   */
+  const OneSkeletonGraph& one_skeleton_graph() const {
+    return graph_;
+  }
+
  private:
   // choose_n_farthest_points wants the distance function in this form...
   template <class Distance>
@@ -19,9 +19,14 @@
 #include <string>
 #include <vector>
 #include <algorithm>    // std::max
+#include <random>
+#include <tuple>
+#include <cstdint>  // for std::uint8_t
 
 #include <gudhi/Rips_complex.h>
 #include <gudhi/Sparse_rips_complex.h>
+#include <gudhi/Implicit_rips_complex.h>
+#include <gudhi/Persistent_cohomology.h>
 // to construct Rips_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
 #include <gudhi/Simplex_tree.h>
@@ -36,6 +41,7 @@ using Filtration_value = Simplex_tree::Filtration_value;
 using Rips_complex = Gudhi::rips_complex::Rips_complex<Simplex_tree::Filtration_value>;
 using Sparse_rips_complex = Gudhi::rips_complex::Sparse_rips_complex<Simplex_tree::Filtration_value>;
 using Distance_matrix = std::vector<std::vector<Filtration_value>>;
+using Implicit_rips_complex = Gudhi::rips_complex::Implicit_rips_complex<Simplex_tree::Filtration_value>;
 
 BOOST_AUTO_TEST_CASE(RIPS_DOC_OFF_file) {
   // ----------------------------------------------------------------------------
@@ -382,6 +388,160 @@ BOOST_AUTO_TEST_CASE(Rips_doc_csv_file) {
 
 }
 
+BOOST_AUTO_TEST_CASE(Rips_complex_grid_proximity_search) {
+  // ----------------------------------------------------------------------------
+  // Grid based proximity graph must be the same as the brute force one
+  // ----------------------------------------------------------------------------
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coord(-1., 1.);
+  for (std::size_t dim : {1, 2, 3, 5}) {
+    Vector_of_points points;
+    for (int idx = 0; idx < 700; ++idx) {
+      Point p;
+      for (std::size_t k = 0; k < dim; ++k) p.push_back(coord(gen));
+      points.push_back(p);
+    }
+    // Duplicated points
+    points.push_back(points[3]);
+    points.push_back(points[0]);
+    for (double threshold : {0., 0.1, 0.35, 3., std::numeric_limits<double>::infinity()}) {
+      std::cout << "========== Rips_complex_grid_proximity_search - dim=" << dim << " - threshold=" << threshold <<
+          " ==========" << std::endl;
+      Rips_complex rips_brute_force(points, threshold, Gudhi::Euclidean_distance());
+      Rips_complex rips_with_grid(points, threshold, Gudhi::Euclidean_distance(),
+                                  Gudhi::rips_complex::Grid_proximity_search());
+      Simplex_tree st_brute_force;
+      rips_brute_force.create_complex(st_brute_force, 1);
+      Simplex_tree st_with_grid;
+      rips_with_grid.create_complex(st_with_grid, 1);
+      std::cout << "st_with_grid.num_simplices()=" << st_with_grid.num_simplices() << std::endl;
+      BOOST_CHECK(st_brute_force == st_with_grid);
+    }
+  }
+  // Empty point cloud
+  Rips_complex rips_empty(Vector_of_points(), 1., Gudhi::Euclidean_distance(),
+                          Gudhi::rips_complex::Grid_proximity_search());
+  Simplex_tree st_empty;
+  rips_empty.create_complex(st_empty, 2);
+  BOOST_CHECK(st_empty.num_simplices() == 0);
+}
+
+template<class FilteredComplex>
+std::vector<std::vector<std::pair<Filtration_value, Filtration_value>>> sorted_diagram(FilteredComplex& cpx, int p) {
+  Gudhi::persistent_cohomology::Persistent_cohomology<FilteredComplex, Gudhi::persistent_cohomology::Field_Zp> pcoh(cpx);
+  pcoh.init_coefficients(p);
+  pcoh.compute_persistent_cohomology();
+  std::vector<std::vector<std::pair<Filtration_value, Filtration_value>>> diagram;
+  for (int dim = 0; dim < cpx.dimension(); ++dim) {
+    diagram.push_back(pcoh.intervals_in_dimension(dim));
+    std::sort(diagram.back().begin(), diagram.back().end());
+  }
+  return diagram;
+}
+
+BOOST_AUTO_TEST_CASE(Implicit_rips_complex_from_points) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> coord(0., 1.);
+  std::vector<Point> points(50, Point(3));
+  for (auto& p : points)
+    for (auto& x : p) x = coord(gen);
+  const Filtration_value threshold = 0.45;
+  Distance_matrix distances(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    for (std::size_t j = 0; j < i; ++j) distances[i].push_back(Gudhi::Euclidean_distance()(points[i], points[j]));
+
+  for (int dim_max : {1, 2, 3, 4}) {
+    Rips_complex rips_complex_from_points(points, threshold, Gudhi::Euclidean_distance());
+    Simplex_tree st;
+    rips_complex_from_points.create_complex(st, dim_max);
+    Implicit_rips_complex implicit_rips(points, threshold, Gudhi::Euclidean_distance(), dim_max);
+    std::cout << "Implicit Rips complex of dimension " << implicit_rips.dimension() << " - "
+        << implicit_rips.num_simplices() << " simplices - " << implicit_rips.num_edges() << " edges - "
+        << implicit_rips.size_in_bytes() << " bytes" << std::endl;
+    BOOST_CHECK(implicit_rips.num_simplices() == st.num_simplices());
+    BOOST_CHECK(implicit_rips.num_vertices() == st.num_vertices());
+    BOOST_CHECK(implicit_rips.dimension() == st.dimension());
+
+    Filtration_value previous = 0;
+    for (auto sh : implicit_rips.filtration_simplex_range()) {
+      auto vertices = implicit_rips.simplex_vertex_range(sh);
+      BOOST_CHECK(static_cast<int>(vertices.size()) == implicit_rips.dimension(sh) + 1);
+      auto st_sh = st.find(vertices);
+      BOOST_CHECK(st_sh != st.null_simplex());
+      BOOST_CHECK(implicit_rips.filtration(sh) == st.filtration(st_sh));
+      // Filtration order
+      BOOST_CHECK(previous <= implicit_rips.filtration(sh));
+      previous = implicit_rips.filtration(sh);
+      // The i-th facet is the simplex without its i-th vertex, and comes before the simplex
+      std::size_t i = 0;
+      for (auto facet : implicit_rips.boundary_simplex_range(sh)) {
+        BOOST_CHECK(facet < sh);
+        auto facet_vertices = vertices;
+        facet_vertices.erase(facet_vertices.begin() + i++);
+        BOOST_CHECK(implicit_rips.simplex_vertex_range(facet) == facet_vertices);
+      }
+      BOOST_CHECK(static_cast<int>(i) == (implicit_rips.dimension(sh) > 0 ? implicit_rips.dimension(sh) + 1 : 0));
+    }
+
+    // Same persistence diagram as with the Simplex_tree, and as with the distance matrix
+    Implicit_rips_complex implicit_rips_from_matrix(distances, threshold, dim_max);
+    BOOST_CHECK(implicit_rips_from_matrix.num_simplices() == st.num_simplices());
+    for (int p : {2, 3}) {
+      auto diagram = sorted_diagram(implicit_rips, p);
+      BOOST_CHECK(diagram == sorted_diagram(st, p));
+      BOOST_CHECK(diagram == sorted_diagram(implicit_rips_from_matrix, p));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Implicit_rips_complex_from_edges) {
+  // A square with a diagonal, and an isolated vertex
+  std::vector<Implicit_rips_complex::Edge> edges = {Implicit_rips_complex::Edge(0, 1, 1.),
+                                                   Implicit_rips_complex::Edge(1, 2, 1.),
+                                                   Implicit_rips_complex::Edge(2, 3, 1.),
+                                                   Implicit_rips_complex::Edge(0, 3, 1.),
+                                                   Implicit_rips_complex::Edge(0, 2, 2.)};
+  Implicit_rips_complex implicit_rips(5, edges, 3);
+  BOOST_CHECK(implicit_rips.num_simplices() == 5 + 5 + 2);
+  BOOST_CHECK(implicit_rips.dimension() == 2);
+  Gudhi::persistent_cohomology::Persistent_cohomology<Implicit_rips_complex,
+                                                      Gudhi::persistent_cohomology::Field_Zp> pcoh(implicit_rips);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  BOOST_CHECK(pcoh.betti_numbers() == std::vector<int>({2, 0}));
+  auto intervals = pcoh.intervals_in_dimension(1);
+  BOOST_CHECK(intervals.size() == 1);
+  BOOST_CHECK(intervals[0] == std::make_pair(1., 2.));
+
+  // A Simplex_key of 8 bits can represent 255 simplices, as one value is reserved for null_key
+  std::vector<Gudhi::rips_complex::Implicit_rips_complex<double, std::uint8_t>::Edge> star;
+  for (int v = 1; v < 128; ++v) star.emplace_back(0, v, 1.);
+  BOOST_CHECK_NO_THROW((Gudhi::rips_complex::Implicit_rips_complex<double, std::uint8_t>(128, star, 1)));
+  star.emplace_back(1, 2, 1.);
+  BOOST_CHECK_THROW((Gudhi::rips_complex::Implicit_rips_complex<double, std::uint8_t>(128, star, 1)),
+                    std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Implicit_rips_complex_sparse_graph_large_dim_max) {
+  // The simplices are only indexed up to the dimension of the largest clique, not up to dim_max
+  std::vector<Implicit_rips_complex::Edge> edges = {Implicit_rips_complex::Edge(0, 9999, 1.)};
+  Implicit_rips_complex implicit_rips(10000, edges, 10);
+  BOOST_CHECK(implicit_rips.num_simplices() == 10000 + 1);
+  BOOST_CHECK(implicit_rips.dimension() == 1);
+
+  // A triangle in a large graph
+  edges = {Implicit_rips_complex::Edge(0, 5000, 1.), Implicit_rips_complex::Edge(5000, 9999, 2.),
+           Implicit_rips_complex::Edge(0, 9999, 3.)};
+  Implicit_rips_complex implicit_triangle(10000, edges, 10);
+  BOOST_CHECK(implicit_triangle.num_simplices() == 10000 + 3 + 1);
+  BOOST_CHECK(implicit_triangle.dimension() == 2);
+  Gudhi::persistent_cohomology::Persistent_cohomology<Implicit_rips_complex,
+                                                      Gudhi::persistent_cohomology::Field_Zp> pcoh(implicit_triangle);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  BOOST_CHECK(pcoh.betti_numbers() == std::vector<int>({9998, 0}));
+}
+
 #ifdef GUDHI_DEBUG
 BOOST_AUTO_TEST_CASE(Rips_create_complex_throw) {
   // ----------------------------------------------------------------------------
@@ -11,6 +11,7 @@
  */
 
 #include <gudhi/Rips_complex.h>
+#include <gudhi/Implicit_rips_complex.h>
 #include <gudhi/distance_functions.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
@@ -26,13 +27,17 @@
 using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
 using Filtration_value = Simplex_tree::Filtration_value;
 using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Implicit_rips_complex = Gudhi::rips_complex::Implicit_rips_complex<Filtration_value>;
 using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
-using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
 using Point = std::vector<double>;
 using Points_off_reader = Gudhi::Points_off_reader<Point>;
 
 void program_options(int argc, char* argv[], std::string& off_file_points, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence);
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     bool& implicit_complex);
+
+template<class FilteredComplex>
+void output_persistence(FilteredComplex& complex, int p, Filtration_value min_persistence, const std::string& filediag);
 
 int main(int argc, char* argv[]) {
   std::string off_file_points;
@@ -41,10 +46,20 @@ int main(int argc, char* argv[]) {
   int dim_max;
   int p;
   Filtration_value min_persistence;
+  bool implicit_complex;
 
-  program_options(argc, argv, off_file_points, filediag, threshold, dim_max, p, min_persistence);
+  program_options(argc, argv, off_file_points, filediag, threshold, dim_max, p, min_persistence,
+                  implicit_complex);
 
   Points_off_reader off_reader(off_file_points);
+  if (implicit_complex) {
+    // Enumerate the simplices from the edges, without a Simplex_tree
+    Implicit_rips_complex implicit_rips(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance(), dim_max);
+    std::cout << "The complex contains " << implicit_rips.num_simplices() << " simplices \n";
+    std::cout << "   and has dimension " << implicit_rips.dimension() << " \n";
+    output_persistence(implicit_rips, p, min_persistence, filediag);
+    return 0;
+  }
   Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
 
   // Construct the Rips complex in a Simplex Tree
@@ -57,8 +72,14 @@ int main(int argc, char* argv[]) {
   // Sort the simplices in the order of the filtration
   simplex_tree.initialize_filtration();
 
+  output_persistence(simplex_tree, p, min_persistence, filediag);
+  return 0;
+}
+
+template<class FilteredComplex>
+void output_persistence(FilteredComplex& complex, int p, Filtration_value min_persistence, const std::string& filediag) {
   // Compute the persistence diagram of the complex
-  Persistent_cohomology pcoh(simplex_tree);
+  Gudhi::persistent_cohomology::Persistent_cohomology<FilteredComplex, Field_Zp> pcoh(complex);
   // initializes the coefficient field for homology
   pcoh.init_coefficients(p);
 
@@ -72,12 +93,11 @@ int main(int argc, char* argv[]) {
     pcoh.output_diagram(out);
     out.close();
   }
-
-  return 0;
 }
 
 void program_options(int argc, char* argv[], std::string& off_file_points, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence) {
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     bool& implicit_complex) {
   namespace po = boost::program_options;
   po::options_description hidden("Hidden options");
   hidden.add_options()("input-file", po::value<std::string>(&off_file_points),
@@ -96,7 +116,10 @@ void program_options(int argc, char* argv[], std::string& off_file_points, std::
       "Characteristic p of the coefficient field Z/pZ for computing homology.")(
       "min-persistence,m", po::value<Filtration_value>(&min_persistence),
       "Minimal lifetime of homology feature to be recorded. Default is 0. Enter a negative value to see zero length "
-      "intervals");
+      "intervals")(
+      "implicit-complex,i", po::bool_switch(&implicit_complex),
+      "Enumerate the simplices of the Rips complex from its edges instead of building a Simplex_tree. Uses much less "
+      "memory.");
 
   po::positional_options_description pos;
   pos.add("input-file", 1);
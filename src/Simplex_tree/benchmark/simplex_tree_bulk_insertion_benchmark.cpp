@@ -0,0 +1,100 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Clock.h>
+#include <gudhi/Points_off_io.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort, std::reverse
+#include <cstdlib>  // for std::atof, std::atoi
+
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Vertex_handle = Simplex_tree::Vertex_handle;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Simplex_and_filtration = std::pair<std::vector<Vertex_handle>, Filtration_value>;
+using Point = std::vector<double>;
+
+/* Rebuilds a Rips complex from the list of its simplices, one simplex at a time with
+ * Simplex_tree::insert_simplex_and_subfaces, and in bulk with Simplex_tree::insert_sorted_simplices and
+ * Simplex_tree::insert_maximal_simplices.
+ * Default values are the ones of performance_rips_persistence (Klein bottle sampling embedded in dimension 5). */
+int main(int argc, char* argv[]) {
+  std::string off_file_name = "Kl.off";
+  Filtration_value threshold = 0.27;
+  int dim_max = 3;
+  if (argc > 1) off_file_name = argv[1];
+  if (argc > 2) threshold = std::atof(argv[2]);
+  if (argc > 3) dim_max = std::atoi(argv[3]);
+
+  Gudhi::Points_off_reader<Point> off_reader(off_file_name);
+  if (!off_reader.is_valid()) {
+    std::cerr << "Unable to read file " << off_file_name << std::endl;
+    return -1;
+  }
+  std::cout << "+ " << off_file_name << " - threshold = " << threshold << " - dim_max = " << dim_max << std::endl;
+
+  Simplex_tree st;
+  st.insert_graph(Gudhi::compute_proximity_graph<Simplex_tree>(off_reader.get_point_cloud(), threshold,
+                                                               Gudhi::Euclidean_distance()));
+  st.expansion(dim_max);
+  std::cout << "    number of simplices = " << st.num_simplices() << " - dimension = " << st.dimension()
+            << std::endl;
+
+  // All the simplices in lexicographic order, and the maximal ones, i.e. those that are not in a boundary, in any order
+  std::vector<Simplex_and_filtration> simplices;
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<Vertex_handle> simplex(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    std::reverse(simplex.begin(), simplex.end());
+    simplices.emplace_back(std::move(simplex), st.filtration(sh));
+  }
+  std::sort(simplices.begin(), simplices.end());
+  std::vector<Simplex_and_filtration> maximal_simplices;
+  for (auto sh : st.complex_simplex_range()) st.assign_key(sh, 0);
+  for (auto sh : st.complex_simplex_range())
+    for (auto b_sh : st.boundary_simplex_range(sh)) st.assign_key(b_sh, 1);
+  for (auto sh : st.complex_simplex_range())
+    if (st.key(sh) == 0)
+      maximal_simplices.emplace_back(std::vector<Vertex_handle>(st.simplex_vertex_range(sh).begin(),
+                                                                st.simplex_vertex_range(sh).end()),
+                                     st.filtration(sh));
+  std::cout << "    number of maximal simplices = " << maximal_simplices.size() << std::endl;
+
+  Gudhi::Clock clock("    Simplex_tree::insert_simplex_and_subfaces for each simplex");
+  Simplex_tree st_one_by_one;
+  for (auto& simplex : simplices)
+    st_one_by_one.insert_simplex_and_subfaces(simplex.first, simplex.second);
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Simplex_tree::insert_simplex_and_subfaces for each maximal simplex");
+  Simplex_tree st_maximal_one_by_one;
+  for (auto& simplex : maximal_simplices)
+    st_maximal_one_by_one.insert_simplex_and_subfaces(simplex.first, simplex.second);
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Simplex_tree::insert_sorted_simplices");
+  Simplex_tree st_sorted;
+  st_sorted.insert_sorted_simplices(simplices);
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Simplex_tree::insert_maximal_simplices");
+  Simplex_tree st_maximal;
+  st_maximal.insert_maximal_simplices(maximal_simplices);
+  std::cout << clock;
+
+  // Built from the maximal simplices, the faces get the smallest filtration value of their maximal cofaces
+  if (st != st_one_by_one || st != st_sorted || st_maximal_one_by_one != st_maximal) {
+    std::cerr << "The complexes differ" << std::endl;
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,96 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Clock.h>
+#include <gudhi/Points_off_io.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>  // for std::atof, std::atoi
+#include <algorithm>  // for std::max
+
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Point = std::vector<double>;
+
+struct Simplex_tree_options_arena : Gudhi::Simplex_tree_options_fast_persistence {
+  typedef Gudhi::Simplex_tree_arena_allocation Allocation_policy;
+};
+using Simplex_tree_arena = Gudhi::Simplex_tree<Simplex_tree_options_arena>;
+
+/* Times the expansion, a traversal and the destruction of a Simplex_tree with a given allocation policy. */
+template<typename Stree, typename Graph>
+void benchmark_allocation_policy(const std::string& msg, const Graph& graph, int dim_max) {
+  std::cout << "+ " << msg << std::endl;
+  Stree* st = new Stree();
+  st->insert_graph(graph);
+  Gudhi::Clock clock("    Simplex_tree::expansion");
+  st->expansion(dim_max);
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Simplex_tree traversal");
+  Filtration_value max_filtration = 0;
+  for (auto sh : st->complex_simplex_range())
+    max_filtration = (std::max)(max_filtration, st->filtration(sh));
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Simplex_tree destruction");
+  delete st;
+  std::cout << clock;
+}
+
+/* Compares Simplex_tree::expansion and Simplex_tree::parallel_expansion on a Rips graph, and the allocation
+ * policies of the Simplex_tree.
+ * Default values are the ones of performance_rips_persistence (Klein bottle sampling embedded in dimension 5). */
+int main(int argc, char* argv[]) {
+  std::string off_file_name = "Kl.off";
+  Filtration_value threshold = 0.27;
+  int dim_max = 3;
+  if (argc > 1) off_file_name = argv[1];
+  if (argc > 2) threshold = std::atof(argv[2]);
+  if (argc > 3) dim_max = std::atoi(argv[3]);
+
+  Gudhi::Points_off_reader<Point> off_reader(off_file_name);
+  if (!off_reader.is_valid()) {
+    std::cerr << "Unable to read file " << off_file_name << std::endl;
+    return -1;
+  }
+  std::cout << "+ " << off_file_name << " - threshold = " << threshold << " - dim_max = " << dim_max << std::endl;
+
+  Gudhi::Clock clock("    Compute proximity graph");
+  auto graph = Gudhi::compute_proximity_graph<Simplex_tree>(off_reader.get_point_cloud(), threshold,
+                                                            Gudhi::Euclidean_distance());
+  std::cout << clock;
+
+  Simplex_tree st_seq;
+  st_seq.insert_graph(graph);
+  Simplex_tree st_par;
+  st_par.insert_graph(graph);
+
+  clock = Gudhi::Clock("    Simplex_tree::expansion");
+  st_seq.expansion(dim_max);
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Simplex_tree::parallel_expansion");
+  st_par.parallel_expansion(dim_max);
+  std::cout << clock;
+
+  std::cout << "    number of simplices = " << st_par.num_simplices() << " - dimension = " << st_par.dimension()
+            << std::endl;
+  if (st_seq != st_par) {
+    std::cerr << "Sequential and parallel expansions differ" << std::endl;
+    return -1;
+  }
+
+  benchmark_allocation_policy<Simplex_tree>("Simplex_tree_default_allocation", graph, dim_max);
+  benchmark_allocation_policy<Simplex_tree_arena>("Simplex_tree_arena_allocation", graph, dim_max);
+  return 0;
+}
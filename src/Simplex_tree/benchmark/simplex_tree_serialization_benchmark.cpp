@@ -0,0 +1,89 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Simplex_tree_binary_file.h>
+#include <gudhi/Clock.h>
+#include <gudhi/Points_off_io.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdlib>  // for std::atof, std::atoi
+
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Point = std::vector<double>;
+
+/* Round trip of a Rips complex through the text format (operator<< and operator>>) and the binary format
+ * (Simplex_tree::serialize and a memory mapped Simplex_tree::deserialize).
+ * Default values are the ones of performance_rips_persistence (Klein bottle sampling embedded in dimension 5). */
+int main(int argc, char* argv[]) {
+  std::string off_file_name = "Kl.off";
+  Filtration_value threshold = 0.27;
+  int dim_max = 3;
+  if (argc > 1) off_file_name = argv[1];
+  if (argc > 2) threshold = std::atof(argv[2]);
+  if (argc > 3) dim_max = std::atoi(argv[3]);
+
+  Gudhi::Points_off_reader<Point> off_reader(off_file_name);
+  if (!off_reader.is_valid()) {
+    std::cerr << "Unable to read file " << off_file_name << std::endl;
+    return -1;
+  }
+  std::cout << "+ " << off_file_name << " - threshold = " << threshold << " - dim_max = " << dim_max << std::endl;
+
+  Simplex_tree st;
+  st.insert_graph(Gudhi::compute_proximity_graph<Simplex_tree>(off_reader.get_point_cloud(), threshold,
+                                                               Gudhi::Euclidean_distance()));
+  st.expansion(dim_max);
+  std::cout << "    number of simplices = " << st.num_simplices() << " - dimension = " << st.dimension()
+            << std::endl;
+
+  const std::string text_file_name = "simplex_tree_serialization_benchmark.txt";
+  Gudhi::Clock clock("    Text format - write");
+  {
+    std::ofstream os(text_file_name);
+    os << st;
+  }
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Text format - read");
+  Simplex_tree st_text;
+  {
+    std::ifstream is(text_file_name);
+    is >> st_text;
+  }
+  std::cout << clock;
+
+  const std::string binary_file_name = "simplex_tree_serialization_benchmark.bin";
+  clock = Gudhi::Clock("    Binary format - write");
+  Gudhi::write_simplex_tree_binary_file(binary_file_name, st);
+  std::cout << clock;
+
+  clock = Gudhi::Clock("    Binary format - memory mapped read");
+  Simplex_tree st_binary;
+  Gudhi::read_simplex_tree_binary_file(binary_file_name, st_binary);
+  std::cout << clock;
+
+  std::ifstream text_file(text_file_name, std::ios::ate);
+  std::ifstream binary_file(binary_file_name, std::ios::binary | std::ios::ate);
+  std::cout << "    text file size = " << text_file.tellg() << " bytes - binary file size = " << binary_file.tellg()
+            << " bytes" << std::endl;
+
+  // The text format rounds the filtration values
+  if (st_text.num_simplices() != st.num_simplices())
+    std::cerr << "The complex read from the text format differs from the original one" << std::endl;
+  if (st != st_binary) {
+    std::cerr << "The complex read from the binary format differs from the original one" << std::endl;
+    return -1;
+  }
+  return 0;
+}
@@ -27,5 +27,12 @@ struct SimplexTreeOptions {
   static const bool store_filtration;
   /// If true, the list of vertices present in the complex must always be 0, ..., num_vertices-1, without any hole.
   static constexpr bool contiguous_vertices;
+  /// Optional. Allocation policy of the internal nodes, `Gudhi::Simplex_tree_default_allocation` (the default when
+  /// this type is not defined) or `Gudhi::Simplex_tree_arena_allocation`.
+  typedef SimplexTreeAllocationPolicy Allocation_policy;
+  /// Optional. If true (the default is false), `Gudhi::Simplex_tree::initialize_filtration()` also stores the boundary
+  /// of each simplex, so that `Gudhi::Simplex_tree::boundary_simplex_range()` does not search the faces in the tree,
+  /// until the next modification of the complex. This costs one more integer per simplex, and one handle per face.
+  static const bool cache_boundaries;
 };
 
@@ -37,7 +37,15 @@ namespace Gudhi {
  * efficient and flexible data structure for representing general (filtered) simplicial complexes. The data structure
  * is described in \cite boissonnatmariasimplextreealgorithmica
  * \image html "Simplex_tree_representation.png" "Simplex tree representation"
- * 
+ *
+ * Besides the text format of its stream operators, a simplex tree can be saved in a compact binary format with
+ * `Gudhi::Simplex_tree::serialize()`, and read back much faster with `Gudhi::Simplex_tree::deserialize()` or, from a
+ * memory mapped file, with `Gudhi::read_simplex_tree_binary_file()`.
+ *
+ * When the simplices are known in advance, `Gudhi::Simplex_tree::insert_sorted_simplices()` and
+ * `Gudhi::Simplex_tree::insert_maximal_simplices()` build each dictionary of the tree once, with its exact size,
+ * instead of inserting the simplices one by one.
+ *
  * \subsubsection filteredcomplexessimplextreeexamples Examples
  * 
  * Here is a list of simplex tree examples :
@@ -0,0 +1,309 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef FLAT_FILTERED_COMPLEX_H_
+#define FLAT_FILTERED_COMPLEX_H_
+
+#include <gudhi/Simplex_tree/indexing_tag.h>
+#include <gudhi/Debug_utils.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <vector>
+#include <algorithm>  // for std::sort
+#include <functional>  // for std::greater
+#include <limits>  // for infinity value
+#include <utility>  // for std::pair
+#include <cstdint>  // for std::uint32_t
+#include <cstddef>  // for std::size_t
+#include <stdexcept>  // for std::out_of_range, std::invalid_argument
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+namespace Gudhi {
+
+/** \brief Read-only, compact representation of a filtered simplicial complex, meant for complexes that are not
+ * modified anymore once built (typically a `Simplex_tree` after `Simplex_tree::expansion()` and
+ * `Simplex_tree::initialize_filtration()`).
+ *
+ * \implements FilteredComplex
+ * \ingroup simplex_tree
+ *
+ * Simplices are stored in filtration order, and a `Simplex_handle` is the position of the simplex in this order.
+ * All the data is stored as a structure of arrays:
+ * - the filtration values,
+ * - one bit per simplex, set when its key is `null_key()`: otherwise the key of a simplex is its `Simplex_handle`,
+ * - the boundaries, in compressed sparse row form: the facets of all the simplices are stored contiguously, as
+ * `Simplex_handle`, in the order given by the boundary of the input complex,
+ * - one vertex per simplex: the vertex itself for a 0-simplex, and for a higher dimensional simplex the vertex that is
+ * not in its first facet. The vertices of a simplex are thus recovered by following the first facets down to a vertex.
+ *
+ * Iterating over the boundary of a simplex reads a contiguous array, instead of searching each facet in a tree as
+ * `Simplex_tree::boundary_simplex_range()` does, and there is no per simplex node nor pointer. This makes it a good
+ * input for `Gudhi::persistent_cohomology::Persistent_cohomology`.
+ *
+ * \tparam FiltrationValue Type of the filtration values.
+ * \tparam SimplexKey Unsigned or signed integer type of the keys and of the simplex handles. It must be able to
+ * represent the number of simplices.
+ * \tparam VertexHandle Type of the vertices.
+ */
+template < typename FiltrationValue = double
+, typename SimplexKey = std::uint32_t
+, typename VertexHandle = int
+>
+class Flat_filtered_complex {
+ public:
+  typedef FiltrationValue Filtration_value;
+  typedef SimplexKey Simplex_key;
+  typedef VertexHandle Vertex_handle;
+  /** \brief Index of the simplex in the filtration order. */
+  typedef SimplexKey Simplex_handle;
+  typedef linear_indexing_tag Indexing_tag;
+
+  typedef boost::counting_iterator< Simplex_handle > Filtration_simplex_iterator;
+  typedef boost::iterator_range<Filtration_simplex_iterator> Filtration_simplex_range;
+
+  typedef const Simplex_handle* Boundary_simplex_iterator;
+  typedef boost::iterator_range<Boundary_simplex_iterator> Boundary_simplex_range;
+
+  typedef typename std::vector< Simplex_handle >::const_iterator Skeleton_simplex_iterator;
+  typedef boost::iterator_range< Skeleton_simplex_iterator > Skeleton_simplex_range;
+
+  /** \brief Vertices of a simplex, in decreasing order. */
+  typedef std::vector< Vertex_handle > Simplex_vertex_range;
+
+  /** \brief Constructs an empty complex. */
+  Flat_filtered_complex()
+      : dim_max_(-1) {
+    offsets_.push_back(0);
+    block_offsets_.push_back(0);
+  }
+
+  /** \brief Constructs the flat copy of a filtered complex, e.g. a `Simplex_tree`.
+   *
+   * The keys of `cpx` are overwritten: `cpx.key(sh)` is set to the position of `sh` in
+   * `cpx.filtration_simplex_range()`, which is also its `Simplex_handle` in the new complex.
+   *
+   * \tparam FilteredComplex must be a model of `FilteredComplex` that additionally provides
+   * `simplex_vertex_range(sh)`, like `Simplex_tree`. When compiled with `GUDHI_USE_TBB`, once the keys are assigned,
+   * `cpx.simplex()`, `cpx.filtration()`, `cpx.dimension()`, `cpx.key()`, `cpx.simplex_vertex_range()` and
+   * `cpx.boundary_simplex_range()` are called concurrently from several threads: they must be safe to call
+   * concurrently on a complex that is not modified meanwhile, as they are for `Simplex_tree`.
+   *
+   * \exception std::out_of_range if `cpx` has more simplices than `Simplex_key` can represent.
+   */
+  template < class FilteredComplex >
+  explicit Flat_filtered_complex(FilteredComplex & cpx)
+      : dim_max_(cpx.dimension()) {
+    std::size_t num_simp = cpx.num_simplices();
+    if (num_simp > static_cast<std::size_t>(std::numeric_limits<Simplex_key>::max()))
+      // One value is reserved for null_key
+      throw std::out_of_range("Flat_filtered_complex - too many simplices for the Simplex_key type.");
+
+    // First pass, sequential: number the simplices in filtration order and lay out the boundaries.
+    filtration_.resize(num_simp);
+    null_keys_.resize(num_simp);
+    vertex_.resize(num_simp);
+    offsets_.resize(num_simp + 1);
+    block_offsets_.resize((num_simp >> block_shift) + 1);
+    std::size_t offset = 0;
+    Simplex_key idx = 0;
+    for (auto sh : cpx.filtration_simplex_range()) {
+      cpx.assign_key(sh, idx);
+      if ((idx & block_mask) == 0) block_offsets_[idx >> block_shift] = offset;
+      offsets_[idx] = static_cast<std::uint32_t>(offset - block_offsets_[idx >> block_shift]);
+      int dim = cpx.dimension(sh);
+      if (dim == 0)
+        vertices_.push_back(idx);
+      else
+        offset += dim + 1;
+      ++idx;
+    }
+    if ((num_simp & block_mask) == 0) block_offsets_[num_simp >> block_shift] = offset;
+    offsets_[num_simp] = static_cast<std::uint32_t>(offset - block_offsets_[num_simp >> block_shift]);
+    boundaries_.resize(offset);
+
+    // Second pass, independent for each simplex: filtration values, boundaries and vertices.
+    auto fill = [&](std::size_t i) {
+      auto sh = cpx.simplex(i);
+      filtration_[i] = cpx.filtration(sh);
+      Simplex_handle* out = boundaries_.data() + boundary_begin(i);
+      auto vertex_range = cpx.simplex_vertex_range(sh);
+      if (cpx.dimension(sh) == 0) {
+        vertex_[i] = *vertex_range.begin();
+        return;
+      }
+      bool first = true;
+      for (auto b_sh : cpx.boundary_simplex_range(sh)) {
+        if (first) {
+          // The vertex of sh that is not in its first facet
+          auto facet_range = cpx.simplex_vertex_range(b_sh);
+          for (auto v : vertex_range) {
+            bool found = false;
+            for (auto w : facet_range) {
+              if (v == w) {
+                found = true;
+                break;
+              }
+            }
+            if (!found) {
+              vertex_[i] = v;
+              break;
+            }
+          }
+          first = false;
+        }
+        *out++ = cpx.key(b_sh);
+      }
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_simp, fill);
+#else
+    for (std::size_t i = 0; i < num_simp; ++i) fill(i);
+#endif
+  }
+
+  /** \brief Returns the number of simplices in the complex. */
+  std::size_t num_simplices() const {
+    return filtration_.size();
+  }
+
+  /** \brief Returns the number of vertices in the complex. */
+  std::size_t num_vertices() const {
+    return vertices_.size();
+  }
+
+  /** \brief Returns an upper bound on the dimension of the simplices, -1 for an empty complex. */
+  int dimension() const {
+    return dim_max_;
+  }
+
+  /** \brief Returns the dimension of a simplex. */
+  int dimension(Simplex_handle sh) const {
+    std::size_t size = boundary_end(sh) - boundary_begin(sh);
+    if (size == 0) return 0;
+    return static_cast<int>(size) - 1;
+  }
+
+  /** \brief Returns the range of all the simplices, in filtration order. */
+  Filtration_simplex_range filtration_simplex_range() const {
+    return Filtration_simplex_range(Filtration_simplex_iterator(0)
+                                    , Filtration_simplex_iterator(static_cast<Simplex_handle>(num_simplices())));
+  }
+
+  /** \brief Does nothing, simplices are already sorted by filtration. */
+  void initialize_filtration() const { }
+
+  /** \brief Returns the range of the vertices of the complex, in filtration order. Only `dim = 0` is supported. */
+  Skeleton_simplex_range skeleton_simplex_range(int dim = 0) const {
+    GUDHI_CHECK(dim == 0, std::invalid_argument("Flat_filtered_complex::skeleton_simplex_range - dimension must be 0"));
+    (void) dim;
+    return Skeleton_simplex_range(vertices_.begin(), vertices_.end());
+  }
+
+  /** \brief Returns the range of the facets of a simplex, in the order of the boundary of the input complex.
+   *
+   * The range is a contiguous array, and is empty for a vertex. */
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) const {
+    const Simplex_handle* data = boundaries_.data();
+    return Boundary_simplex_range(data + boundary_begin(sh), data + boundary_end(sh));
+  }
+
+  /** \brief Returns the two vertices of an edge. */
+  std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) const {
+    std::size_t begin = boundary_begin(sh);
+    return std::pair<Simplex_handle, Simplex_handle>(boundaries_[begin], boundaries_[begin + 1]);
+  }
+
+  /** \brief Returns the vertices of a simplex, in decreasing order. */
+  Simplex_vertex_range simplex_vertex_range(Simplex_handle sh) const {
+    Simplex_vertex_range vertices;
+    vertices.reserve(dimension(sh) + 1);
+    while (true) {
+      vertices.push_back(vertex_[sh]);
+      if (boundary_begin(sh) == boundary_end(sh)) break;
+      sh = boundaries_[boundary_begin(sh)];
+    }
+    std::sort(vertices.begin(), vertices.end(), std::greater<Vertex_handle>());
+    return vertices;
+  }
+
+  Filtration_value filtration(Simplex_handle sh) const {
+    if (sh == null_simplex()) {
+      return std::numeric_limits<Filtration_value>::infinity();
+    }
+    return filtration_[sh];
+  }
+
+  /** \brief Returns the key of a simplex: its `Simplex_handle`, or `null_key()` if it was assigned so. */
+  Simplex_key key(Simplex_handle sh) const {
+    return null_keys_[sh] ? null_key() : sh;
+  }
+
+  /** \brief Assigns a key to a simplex. The key must be either `sh` itself or `null_key()`, as the keys are not
+   * stored. */
+  void assign_key(Simplex_handle sh, Simplex_key key) {
+    GUDHI_CHECK(key == sh || key == null_key(),
+                std::invalid_argument("Flat_filtered_complex::assign_key - the key must be sh or null_key()"));
+    null_keys_[sh] = (key == null_key());
+  }
+
+  static Simplex_key null_key() {
+    return static_cast<Simplex_key>(-1);
+  }
+
+  Simplex_handle simplex(Simplex_key key) const {
+    if (key == null_key()) return null_simplex();
+    return key;
+  }
+
+  static Simplex_handle null_simplex() {
+    return static_cast<Simplex_handle>(-1);
+  }
+
+  /** \brief Returns the number of bytes used by the arrays of the complex. */
+  std::size_t size_in_bytes() const {
+    return sizeof(*this)
+        + filtration_.capacity() * sizeof(Filtration_value)
+        + null_keys_.capacity() / 8
+        + vertex_.capacity() * sizeof(Vertex_handle)
+        + offsets_.capacity() * sizeof(std::uint32_t)
+        + block_offsets_.capacity() * sizeof(std::size_t)
+        + boundaries_.capacity() * sizeof(Simplex_handle)
+        + vertices_.capacity() * sizeof(Simplex_handle);
+  }
+
+ private:
+  // Boundary offsets are stored on 32 bits, relative to the offset of the block of 2^block_shift simplices they
+  // belong to.
+  static const int block_shift = 16;
+  static const std::size_t block_mask = (std::size_t(1) << block_shift) - 1;
+
+  std::size_t boundary_begin(std::size_t i) const {
+    return block_offsets_[i >> block_shift] + offsets_[i];
+  }
+
+  std::size_t boundary_end(std::size_t i) const {
+    return boundary_begin(i + 1);
+  }
+
+  std::vector<Filtration_value> filtration_;
+  std::vector<bool> null_keys_;
+  std::vector<Vertex_handle> vertex_;
+  std::vector<std::uint32_t> offsets_;
+  std::vector<std::size_t> block_offsets_;
+  std::vector<Simplex_handle> boundaries_;
+  std::vector<Simplex_handle> vertices_;
+  int dim_max_;
+};
+
+}  // namespace Gudhi
+
+#endif  // FLAT_FILTERED_COMPLEX_H_
@@ -17,6 +17,9 @@
 #include <gudhi/Simplex_tree/Simplex_tree_siblings.h>
 #include <gudhi/Simplex_tree/Simplex_tree_iterators.h>
 #include <gudhi/Simplex_tree/indexing_tag.h>
+#include <gudhi/Simplex_tree/Simplex_tree_allocation.h>
+#include <gudhi/Simplex_tree/Simplex_tree_filtration_sort.h>
+#include <gudhi/Simplex_tree/serialization_utils.h>
 
 #include <gudhi/reader_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
@@ -29,6 +32,9 @@
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
+#include <tbb/combinable.h>
+#include <tbb/enumerable_thread_specific.h>
 #endif
 
 #include <utility>
@@ -40,11 +46,27 @@
 #include <algorithm>  // for std::max
 #include <cstdint>  // for std::uint32_t
 #include <iterator>  // for std::distance
+#include <numeric>  // for std::partial_sum
+#include <cstddef>  // for std::size_t
+#include <type_traits>  // for std::make_unsigned
 
 namespace Gudhi {
 
 struct Simplex_tree_options_full_featured;
 
+/** \private Whether a SimplexTreeOptions asks for a boundary cache: Options::cache_boundaries if it exists, false
+ * otherwise. */
+template<class Options, class = void>
+struct Simplex_tree_cache_boundaries_option {
+  static const bool value = false;
+};
+
+template<class Options>
+struct Simplex_tree_cache_boundaries_option<Options, typename std::conditional<true, void,
+                                                                               decltype(Options::cache_boundaries)>::type> {
+  static const bool value = Options::cache_boundaries;
+};
+
 /**
  * \class Simplex_tree Simplex_tree.h gudhi/Simplex_tree.h
  * \brief Simplex Tree data structure for representing simplicial complexes.
@@ -75,6 +97,14 @@ class Simplex_tree {
    *
    * Must be a signed integer type. It admits a total order <. */
   typedef typename Options::Vertex_handle Vertex_handle;
+  /** \brief Allocation policy of the Siblings and their dictionaries.
+   *
+   * `SimplexTreeOptions::Allocation_policy` if defined, `Simplex_tree_default_allocation` otherwise. */
+  typedef typename Simplex_tree_allocation_policy<Options>::type Allocation_policy;
+  /** \brief Whether the boundaries of the simplices are cached by `initialize_filtration()`.
+   *
+   * `SimplexTreeOptions::cache_boundaries` if defined, false otherwise. */
+  static const bool cache_boundaries = Simplex_tree_cache_boundaries_option<Options>::value;
 
   /* Type of node in the simplex tree. */
   typedef Simplex_tree_node_explicit_storage<Simplex_tree> Node;
@@ -82,7 +112,7 @@ class Simplex_tree {
   // Note: this wastes space when Vertex_handle is 32 bits and Node is aligned on 64 bits. It would be better to use a
   // flat_set (with our own comparator) where we can control the layout of the struct (put Vertex_handle and
   // Simplex_key next to each other).
-  typedef typename boost::container::flat_map<Vertex_handle, Node> Dictionary;
+  typedef typename Allocation_policy::template Dictionary<Vertex_handle, Node> Dictionary;
 
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
@@ -119,6 +149,21 @@ class Simplex_tree {
   typedef typename std::conditional<Options::store_filtration, Filtration_simplex_base_real,
     Filtration_simplex_base_dummy>::type Filtration_simplex_base;
 
+  struct Boundary_cache_simplex_base_real {
+    Boundary_cache_simplex_base_real() : boundary_index_(0) {}
+    void assign_boundary_index(std::size_t i) { boundary_index_ = i; }
+    std::size_t boundary_index() const { return boundary_index_; }
+   private:
+    std::size_t boundary_index_;
+  };
+  struct Boundary_cache_simplex_base_dummy {
+    Boundary_cache_simplex_base_dummy() {}
+    void assign_boundary_index(std::size_t) {}
+    std::size_t boundary_index() const { return 0; }
+  };
+  typedef typename std::conditional<cache_boundaries, Boundary_cache_simplex_base_real,
+    Boundary_cache_simplex_base_dummy>::type Boundary_cache_simplex_base;
+
  public:
   /** \brief Handle type to a simplex contained in the simplicial complex represented
    * by the simplex tree. */
@@ -283,7 +328,9 @@ class Simplex_tree {
       : null_vertex_(-1),
       root_(nullptr, null_vertex_),
       filtration_vect_(),
-      dimension_(-1) { }
+      dimension_(-1) {
+    root_.members_ = Dictionary(typename Dictionary::key_compare(), dictionary_allocator());
+  }
 
   /** \brief User-defined copy constructor reproduces the whole tree structure. */
   Simplex_tree(const Simplex_tree& complex_source) {
@@ -309,7 +356,9 @@ class Simplex_tree {
 
   /** \brief Destructor; deallocates the whole tree structure. */
   ~Simplex_tree() {
-    root_members_recursive_deletion();
+    // With an arena, the whole tree is released with the allocation resource
+    if (!Allocation_resource::releases_all_at_once)
+      root_members_recursive_deletion();
   }
 
   /** \brief User-defined copy assignment reproduces the whole tree structure. */
@@ -350,11 +399,14 @@ class Simplex_tree {
   void copy_from(const Simplex_tree& complex_source) {
     null_vertex_ = complex_source.null_vertex_;
     filtration_vect_.clear();
+    boundary_cache_.clear();
     dimension_ = complex_source.dimension_;
     auto root_source = complex_source.root_;
 
     // root members copy
-    root_.members() = Dictionary(boost::container::ordered_unique_range, root_source.members().begin(), root_source.members().end());
+    root_.members() = Dictionary(boost::container::ordered_unique_range, root_source.members().begin(),
+                                 root_source.members().end(), typename Dictionary::key_compare(),
+                                 dictionary_allocator());
     // Needs to reassign children
     for (auto& map_el : root_.members()) {
       map_el.second.assign_children(&root_);
@@ -367,7 +419,7 @@ class Simplex_tree {
     for (auto sh = sib->members().begin(), sh_source = sib_source->members().begin();
          sh != sib->members().end(); ++sh, ++sh_source) {
       if (has_children(sh_source)) {
-        Siblings * newsib = new Siblings(sib, sh_source->first);
+        Siblings * newsib = new_siblings(sib, sh_source->first);
         newsib->members_.reserve(sh_source->second.children()->members().size());
         for (auto & child : sh_source->second.children()->members())
           newsib->members_.emplace_hint(newsib->members_.end(), child.first, Node(newsib, child.second.filtration()));
@@ -380,8 +432,15 @@ class Simplex_tree {
   // Move from complex_source to "this"
   void move_from(Simplex_tree& complex_source) {
     null_vertex_ = std::move(complex_source.null_vertex_);
+    // The moved tree lives in the memory resource of complex_source
+    allocation_resource_ = std::move(complex_source.allocation_resource_);
+    complex_source.allocation_resource_ = Allocation_resource();
     root_ = std::move(complex_source.root_);
+    complex_source.root_.members_ = Dictionary(typename Dictionary::key_compare(),
+                                               complex_source.dictionary_allocator());
     filtration_vect_ = std::move(complex_source.filtration_vect_);
+    // The moved nodes keep their addresses, so their cached boundaries remain valid
+    boundary_cache_ = std::move(complex_source.boundary_cache_);
     dimension_ = std::move(complex_source.dimension_);
 
     // Need to update root members (children->oncles and children need to point on the new root pointer)
@@ -401,6 +460,14 @@ class Simplex_tree {
 
   // delete all root_.members() recursively
   void root_members_recursive_deletion() {
+    if (Allocation_resource::releases_all_at_once) {
+      // Replacing the resource releases all the Siblings at once
+      Allocation_resource new_resource;
+      root_.members_ = Dictionary(typename Dictionary::key_compare(),
+                                  new_resource.template dictionary_allocator<Dictionary>());
+      allocation_resource_ = std::move(new_resource);
+      return;
+    }
     for (auto sh = root_.members().begin(); sh != root_.members().end(); ++sh) {
       if (has_children(sh)) {
         rec_delete(sh->second.children());
@@ -416,7 +483,23 @@ class Simplex_tree {
         rec_delete(sh->second.children());
       }
     }
-    delete sib;
+    delete_siblings(sib);
+  }
+
+  /* Allocates a new Siblings with the allocation policy. */
+  template<class...Args>
+  Siblings* new_siblings(Args&&...args) {
+    return allocation_resource_.template new_siblings<Siblings>(std::forward<Args>(args)...);
+  }
+
+  /* Deallocates a Siblings allocated with new_siblings. */
+  void delete_siblings(Siblings* sib) {
+    allocation_resource_.delete_siblings(sib);
+  }
+
+  /* Allocator for the dictionaries of this Simplex_tree. */
+  typename Dictionary::allocator_type dictionary_allocator() const {
+    return allocation_resource_.template dictionary_allocator<Dictionary>();
   }
 
  public:
@@ -664,6 +747,7 @@ class Simplex_tree {
   */
   std::pair<Simplex_handle, bool> insert_vertex_vector(const std::vector<Vertex_handle>& simplex,
                                                      Filtration_value filtration) {
+    clear_boundary_cache();
     Siblings * curr_sib = &root_;
     std::pair<Simplex_handle, bool> res_insert;
     auto vi = simplex.begin();
@@ -671,7 +755,7 @@ class Simplex_tree {
       GUDHI_CHECK(*vi != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
       res_insert = curr_sib->members_.emplace(*vi, Node(curr_sib, filtration));
       if (!(has_children(res_insert.first))) {
-        res_insert.first->second.assign_children(new Siblings(curr_sib, *vi));
+        res_insert.first->second.assign_children(new_siblings(curr_sib, *vi));
       }
       curr_sib = res_insert.first->second.children();
     }
@@ -783,6 +867,7 @@ class Simplex_tree {
     if (first == last)
       return { null_simplex(), true }; // FIXME: false would make more sense to me.
     GUDHI_CHECK(std::is_sorted(first, last), "simplex vertices listed in unsorted order");
+    clear_boundary_cache();
     // Update dimension if needed. We could wait to see if the insertion succeeds, but I doubt there is much to gain.
     dimension_ = (std::max)(dimension_, static_cast<int>(std::distance(first, last)) - 1);
     return rec_insert_simplex_and_subfaces_sorted(root(), first, last, filt);
@@ -810,13 +895,290 @@ class Simplex_tree {
     if (++first == last) return insertion_result;
     if (!has_children(simplex_one))
       // TODO: have special code here, we know we are building the whole subtree from scratch.
-      simplex_one->second.assign_children(new Siblings(sib, vertex_one));
+      simplex_one->second.assign_children(new_siblings(sib, vertex_one));
     auto res = rec_insert_simplex_and_subfaces_sorted(simplex_one->second.children(), first, last, filt);
     // No need to continue if the full simplex was already there with a low enough filtration value.
     if (res.first != null_simplex()) rec_insert_simplex_and_subfaces_sorted(sib, first, last, filt);
     return res;
   }
 
+ private:
+  /* Simplices of a dictionary under construction, with the Siblings of their children (nullptr if none). */
+  struct Pending_siblings {
+    std::vector<Dit_value_t> members;
+    std::vector<Siblings*> children;
+  };
+
+  /* Vertices of a simplex given to insert_maximal_simplices that follow one of its faces: they start at first in the
+   * renumbered vertices of all the simplices and end before the next end_of_simplex. */
+  struct Maximal_simplex_suffix {
+    // Not initialized, so that resizing a vector of suffixes before filling it costs nothing
+    Maximal_simplex_suffix() { }
+    Maximal_simplex_suffix(std::size_t f, Filtration_value filt) : first(f), filtration(filt) { }
+    std::size_t first;
+    Filtration_value filtration;
+  };
+
+  /* Vertices of the simplices given to insert_maximal_simplices, renumbered 0, 1, ... in the same order, one simplex
+   * after the other, each followed by end_of_simplex. */
+  struct Maximal_simplices_vertices {
+    typedef typename std::make_unsigned<Vertex_handle>::type Vertex_id;
+    static const Vertex_id end_of_simplex = static_cast<Vertex_id>(-1);
+    std::vector<Vertex_id> ids;
+    std::vector<Vertex_handle> vertex_of_id;
+    // Scratch counters of the counting sort, one per vertex, always 0 between two uses
+    std::vector<std::size_t> counts;
+  };
+
+  /* Scratch memory of insert_maximal_simplices for one depth of the recursion. */
+  struct Maximal_simplices_level {
+    // The suffixes that follow each vertex of the level, grouped by vertex
+    std::vector<Maximal_simplex_suffix> suffixes;
+    // The vertices of the level, sorted, and the beginning of their group in suffixes
+    std::vector<std::size_t> ids;
+    std::vector<std::size_t> group_begin;
+    Pending_siblings siblings;
+  };
+
+ public:
+  /** \brief Builds the complex from the list of all its simplices, in lexicographic order.
+   *
+   * Each element `s` of the range gives the vertices of a simplex in increasing order as `s.first`, and its filtration
+   * value as `s.second`, as a `std::pair<std::vector<Vertex_handle>, Filtration_value>` does. The simplices must be
+   * listed in increasing lexicographic order (e.g. {0}, {0, 1}, {0, 1, 2}, {0, 2}, {1}, ...), which is the order of a
+   * depth-first traversal of the tree, so each dictionary is built only once, with its exact size, when all its
+   * simplices have been read. The range is traversed once, and may be a single pass input range.
+   *
+   * This is much faster than inserting the simplices one by one, but nothing is done to make the complex valid: all
+   * the faces of a simplex must be in the list, with a filtration value that is not larger.
+   *
+   * @param[in] simplices Range of the simplices of the complex and their filtration values.
+   * @pre The Simplex_tree must be empty.
+   * @exception std::invalid_argument If the simplices are not in increasing lexicographic order, if the vertices of a
+   * simplex are not in increasing order, or if a simplex is listed before the simplex obtained by removing its largest
+   * vertex. The Simplex_tree is then left empty.
+   */
+  template<class SimplexFiltrationRange>
+  void insert_sorted_simplices(const SimplexFiltrationRange& simplices) {
+    GUDHI_CHECK(num_vertices() == 0,
+                std::logic_error("Simplex_tree::insert_sorted_simplices - the Simplex_tree must be empty"));
+    clear_boundary_cache();
+    // levels[d] holds the simplices of dimension d read since their parent was read, with the Siblings built for
+    // their own children. Only the levels up to depth are in use, the others are kept to reuse their memory.
+    std::vector<Pending_siblings> levels;
+    std::size_t depth = 0;
+    try {
+      for (auto&& simplex : simplices) {
+        auto first = std::begin(simplex.first);
+        auto last = std::end(simplex.first);
+        if (first == last) continue;
+        // All the vertices but the last one must be the current path, i.e. the parent of the simplex must be the
+        // last simplex read at its dimension.
+        std::size_t dim = 0;
+        for (; std::next(first) != last; ++first, ++dim)
+          if (dim >= depth || levels[dim].members.back().first != *first)
+            throw std::invalid_argument("Simplex_tree::insert_sorted_simplices - missing face or unsorted simplices");
+        Vertex_handle v = *first;
+        GUDHI_CHECK(v != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
+        if (dim < depth) {
+          // Next sibling of a simplex of the path, whose children are now complete
+          if (!(levels[dim].members.back().first < v))
+            throw std::invalid_argument("Simplex_tree::insert_sorted_simplices - unsorted simplices");
+          while (depth > dim + 1) close_pending_siblings(levels, depth);
+        } else {
+          // First child of the last simplex read, whose vertex must be larger than the vertex of its parent
+          if (dim > 0 && !(levels[dim - 1].members.back().first < v))
+            throw std::invalid_argument("Simplex_tree::insert_sorted_simplices - unsorted simplices");
+          if (levels.size() == depth) levels.emplace_back();
+          ++depth;
+        }
+        levels[dim].members.emplace_back(v, Node(nullptr, simplex.second));
+        levels[dim].children.push_back(nullptr);
+        dimension_ = (std::max)(dimension_, static_cast<int>(dim));
+      }
+      while (depth > 1) close_pending_siblings(levels, depth);
+      if (depth == 1) set_root_members(levels[0]);
+    } catch (...) {
+      for (Pending_siblings& level : levels)
+        for (Siblings* children : level.children)
+          if (children != nullptr) rec_delete(children);
+      dimension_ = -1;
+      throw;
+    }
+  }
+
+  /** \brief Builds the complex generated by a list of simplices, typically its maximal simplices.
+   *
+   * Each element `s` of the range gives the vertices of a simplex as `s.first`, and its filtration value as
+   * `s.second`, as a `std::pair<std::vector<Vertex_handle>, Filtration_value>` does. The simplices may be listed in
+   * any order. As with `insert_simplex_and_subfaces()`, each face gets the smallest filtration value of the listed
+   * simplices that contain it.
+   *
+   * Instead of inserting the faces one at a time, the vertices are renumbered so that the simplices can be grouped by
+   * vertex with a counting sort, then the remainders of the simplices after each vertex recursively, so each
+   * dictionary is built only once, with its exact size. The range is traversed twice.
+   *
+   * @param[in] simplices Range of the simplices and their filtration values.
+   * @pre The Simplex_tree must be empty.
+   */
+  template<class SimplexFiltrationRange>
+  void insert_maximal_simplices(const SimplexFiltrationRange& simplices) {
+    GUDHI_CHECK(num_vertices() == 0,
+                std::logic_error("Simplex_tree::insert_maximal_simplices - the Simplex_tree must be empty"));
+    typedef typename Maximal_simplices_vertices::Vertex_id Vertex_id;
+    clear_boundary_cache();
+    std::size_t num_simplices = 0;
+    std::size_t num_vertices = 0;
+    for (auto&& simplex : simplices) {
+      ++num_simplices;
+      num_vertices += std::distance(std::begin(simplex.first), std::end(simplex.first)) + 1;
+    }
+    // The simplices are the suffixes of the empty face. Their sorted vertices are stored one after the other, each
+    // simplex followed by a free slot for end_of_simplex.
+    std::vector<Maximal_simplex_suffix> suffixes;
+    suffixes.reserve(num_simplices);
+    std::vector<Vertex_handle> all_vertices;
+    all_vertices.reserve(num_vertices);
+    for (auto&& simplex : simplices) {
+      std::size_t first = all_vertices.size();
+      all_vertices.insert(all_vertices.end(), std::begin(simplex.first), std::end(simplex.first));
+      std::sort(all_vertices.begin() + first, all_vertices.end());
+      all_vertices.erase(std::unique(all_vertices.begin() + first, all_vertices.end()), all_vertices.end());
+      if (all_vertices.size() == first) continue;
+      GUDHI_CHECK_code(
+        for (std::size_t i = first; i < all_vertices.size(); ++i)
+          GUDHI_CHECK(all_vertices[i] != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
+      )
+      dimension_ = (std::max)(dimension_, static_cast<int>(all_vertices.size() - first) - 1);
+      all_vertices.push_back(all_vertices.back());
+      suffixes.emplace_back(first, simplex.second);
+    }
+    if (suffixes.empty()) return;
+    // Renumbering of the vertices, in the same order: by an offset when they are dense enough, as for a Rips complex,
+    // and by their rank otherwise.
+    Maximal_simplices_vertices vertices;
+    auto bounds = std::minmax_element(all_vertices.begin(), all_vertices.end());
+    Vertex_handle min_vertex = *bounds.first;
+    std::size_t range = static_cast<std::size_t>(*bounds.second) - static_cast<std::size_t>(min_vertex);
+    const bool dense = range < 2 * all_vertices.size();
+    if (dense) {
+      vertices.vertex_of_id.resize(range + 1);
+      for (std::size_t id = 0; id <= range; ++id)
+        vertices.vertex_of_id[id] = static_cast<Vertex_handle>(min_vertex + id);
+    } else {
+      vertices.vertex_of_id = all_vertices;
+      std::sort(vertices.vertex_of_id.begin(), vertices.vertex_of_id.end());
+      vertices.vertex_of_id.erase(std::unique(vertices.vertex_of_id.begin(), vertices.vertex_of_id.end()),
+                                  vertices.vertex_of_id.end());
+    }
+    vertices.ids.resize(all_vertices.size());
+    for (std::size_t i = 0; i < suffixes.size(); ++i) {
+      std::size_t last = (i + 1 < suffixes.size() ? suffixes[i + 1].first : all_vertices.size()) - 1;
+      for (std::size_t pos = suffixes[i].first; pos < last; ++pos) {
+        if (dense)
+          vertices.ids[pos] = static_cast<Vertex_id>(static_cast<std::size_t>(all_vertices[pos]) -
+                                                     static_cast<std::size_t>(min_vertex));
+        else
+          vertices.ids[pos] = static_cast<Vertex_id>(std::lower_bound(vertices.vertex_of_id.begin(),
+                                                                      vertices.vertex_of_id.end(), all_vertices[pos])
+                                                     - vertices.vertex_of_id.begin());
+      }
+      vertices.ids[last] = Maximal_simplices_vertices::end_of_simplex;
+    }
+    std::vector<Vertex_handle>().swap(all_vertices);
+    vertices.counts.assign(vertices.vertex_of_id.size(), 0);
+    // One level per vertex of the largest simplex
+    std::vector<Maximal_simplices_level> levels(dimension_ + 1);
+    rec_insert_maximal_simplices(vertices, levels, 0, suffixes.data(), suffixes.data() + suffixes.size());
+    set_root_members(levels[0].siblings);
+  }
+
+ private:
+  /* Fills levels[depth].siblings with the vertices of the suffixes in [first, last), each with the Siblings of the
+   * complex generated by the suffixes that follow this vertex. These suffixes are grouped by vertex with a counting
+   * sort, so the suffixes of a child are a contiguous range of the suffixes of its parent. */
+  void rec_insert_maximal_simplices(Maximal_simplices_vertices& vertices, std::vector<Maximal_simplices_level>& levels,
+                                    std::size_t depth, const Maximal_simplex_suffix* first,
+                                    const Maximal_simplex_suffix* last) {
+    const auto end_of_simplex = Maximal_simplices_vertices::end_of_simplex;
+    Maximal_simplices_level& level = levels[depth];
+    std::vector<std::size_t>& counts = vertices.counts;
+    level.ids.clear();
+    for (const Maximal_simplex_suffix* suffix = first; suffix != last; ++suffix)
+      for (std::size_t pos = suffix->first; vertices.ids[pos] != end_of_simplex; ++pos)
+        if (counts[vertices.ids[pos]]++ == 0) level.ids.push_back(vertices.ids[pos]);
+    std::sort(level.ids.begin(), level.ids.end());
+    level.group_begin.resize(level.ids.size() + 1);
+    std::size_t num_suffixes = 0;
+    for (std::size_t i = 0; i < level.ids.size(); ++i) {
+      level.group_begin[i] = num_suffixes;
+      num_suffixes += counts[level.ids[i]];
+      counts[level.ids[i]] = level.group_begin[i];
+    }
+    level.group_begin.back() = num_suffixes;
+    level.suffixes.resize(num_suffixes);
+    for (const Maximal_simplex_suffix* suffix = first; suffix != last; ++suffix)
+      for (std::size_t pos = suffix->first; vertices.ids[pos] != end_of_simplex; ++pos)
+        level.suffixes[counts[vertices.ids[pos]]++] = Maximal_simplex_suffix(pos + 1, suffix->filtration);
+    for (std::size_t id : level.ids) counts[id] = 0;
+
+    for (std::size_t i = 0; i < level.ids.size(); ++i) {
+      const Maximal_simplex_suffix* group = level.suffixes.data() + level.group_begin[i];
+      const Maximal_simplex_suffix* group_end = level.suffixes.data() + level.group_begin[i + 1];
+      Filtration_value filtration = group->filtration;
+      bool has_children = false;
+      for (const Maximal_simplex_suffix* suffix = group; suffix != group_end; ++suffix) {
+        filtration = (std::min)(filtration, suffix->filtration);
+        has_children = has_children || vertices.ids[suffix->first] != end_of_simplex;
+      }
+      Vertex_handle v = vertices.vertex_of_id[level.ids[i]];
+      Siblings* sib = nullptr;
+      if (has_children) {
+        rec_insert_maximal_simplices(vertices, levels, depth + 1, group, group_end);
+        Pending_siblings& children = levels[depth + 1].siblings;
+        sib = new_siblings(&root_, v, children.members);
+        attach_pending_children(sib, children);
+        children.members.clear();
+        children.children.clear();
+      }
+      level.siblings.members.emplace_back(v, Node(nullptr, filtration));
+      level.siblings.children.push_back(sib);
+    }
+  }
+
+  /* Builds the Siblings of the deepest level in use, with the exact size, and attaches it to its parent, the last
+   * simplex of the level above. */
+  void close_pending_siblings(std::vector<Pending_siblings>& levels, std::size_t& depth) {
+    Pending_siblings& level = levels[depth - 1];
+    // The Siblings gets its real oncles when its parent level is closed, the root only provides the allocator here.
+    Siblings* sib = new_siblings(&root_, levels[depth - 2].members.back().first, level.members);
+    levels[depth - 2].children.back() = sib;
+    attach_pending_children(sib, level);
+    level.members.clear();
+    level.children.clear();
+    --depth;
+  }
+
+  /* Attaches the Siblings built for the children of the members of sib. */
+  void attach_pending_children(Siblings* sib, Pending_siblings& level) {
+    auto member = sib->members_.begin();
+    for (Siblings* children : level.children) {
+      if (children != nullptr) {
+        member->second.assign_children(children);
+        children->oncles_ = sib;
+      }
+      ++member;
+    }
+  }
+
+  /* Builds the vertices of the complex, with the exact size. */
+  void set_root_members(Pending_siblings& level) {
+    root_.members_ = Dictionary(boost::container::ordered_unique_range, level.members.begin(), level.members.end(),
+                                typename Dictionary::key_compare(), dictionary_allocator());
+    for (auto& map_el : root_.members()) map_el.second.assign_children(&root_);
+    attach_pending_children(&root_, level);
+  }
+
  public:
   /** \brief Assign a value 'key' to the key of the simplex
    * represented by the Simplex_handle 'sh'. */
@@ -841,6 +1203,14 @@ class Simplex_tree {
       return sh->second.children();
   }
 
+  /** \private Returns the cached boundary of a simplex, terminated by `null_simplex()`, or nullptr if the boundaries
+   * are not cached. */
+  template<class SimplexHandle>
+  const Simplex_handle* cached_boundary(SimplexHandle sh) const {
+    if (!cache_boundaries || boundary_cache_.empty()) return nullptr;
+    return &boundary_cache_[sh->second.boundary_index()];
+  }
+
  public:
   /** Returns a pointer to the root nodes of the simplex tree. */
   Siblings * root() {
@@ -865,30 +1235,123 @@ class Simplex_tree {
    * simplicial complex with m simplices).
    *
    * Will be automatically called when calling filtration_simplex_range()
-   * if the filtration has never been initialized yet. */
+   * if the filtration has never been initialized yet.
+   *
+   * If `SimplexTreeOptions::cache_boundaries` is true, the boundaries of all the simplices are also computed and
+   * stored, so that `boundary_simplex_range()` does not need to search the faces in the tree anymore, until the
+   * complex is modified. */
   void initialize_filtration() {
-    filtration_vect_.clear();
-    filtration_vect_.reserve(num_simplices());
-    for (Simplex_handle sh : complex_simplex_range())
-      filtration_vect_.push_back(sh);
-
-    /* We use stable_sort here because with libstdc++ it is faster than sort.
-     * is_before_in_filtration is now a total order, but we used to call
-     * stable_sort for the following heuristic:
-     * The use of a depth-first traversal of the simplex tree, provided by
-     * complex_simplex_range(), combined with a stable sort is meant to
-     * optimize the order of simplices with same filtration value. The
-     * heuristic consists in inserting the cofaces of a simplex as soon as
-     * possible.
+    /* Rather than sorting the simplices with is_before_in_filtration, which walks up the tree to compare simplices
+     * with the same filtration value, the simplices are first listed in reverse lexicographic order, and then stably
+     * sorted by filtration value, through a flat array of keys. The order is the same.
+     * In reverse lexicographic order, the simplices are grouped by largest vertex, and for a same largest vertex,
+     * sorted by the rest of the simplex, i.e. by their parent in the tree. So the group of a vertex is the vertex
+     * itself followed by its nodes in the children of the simplices listed before, in the order of their parents.
      */
+    auto& vertices = root_.members();
+    auto vertex_index = [&vertices](Vertex_handle v) -> std::size_t {
+      if (Options::contiguous_vertices) return v;
+      return vertices.find(v) - vertices.begin();
+    };
+    GUDHI_CHECK(!Options::contiguous_vertices || contiguous_vertices(), "non-contiguous vertices");
+    std::vector<std::size_t> next_in_group(vertices.size() + 1, 0);
+    for (Simplex_handle sh : complex_simplex_range())
+      ++next_in_group[vertex_index(sh->first) + 1];
+    std::partial_sum(next_in_group.begin(), next_in_group.end(), next_in_group.begin());
+    filtration_vect_.resize(next_in_group.back());
+    boundary_cache_.clear();
+    if (cache_boundaries) {
+      // The vertices share the empty boundary at index 0.
+      boundary_cache_.reserve(filtration_vect_.size() * 4);
+      boundary_cache_.push_back(null_simplex());
+    }
+    for (auto vertex = vertices.begin(); vertex != vertices.end(); ++vertex) {
+      filtration_vect_[next_in_group[vertex - vertices.begin()]++] = vertex;
+      if (cache_boundaries) vertex->second.assign_boundary_index(0);
+    }
+    // The parent of a simplex, and the faces of its parent, are listed before the simplex itself.
+    for (std::size_t i = 0; i < filtration_vect_.size(); ++i) {
+      Simplex_handle sh = filtration_vect_[i];
+      if (has_children(sh)) {
+        auto& children = sh->second.children()->members();
+        for (auto child = children.begin(); child != children.end(); ++child)
+          filtration_vect_[next_in_group[vertex_index(child->first)]++] = child;
+        if (cache_boundaries) cache_boundaries_of_children(sh);
+      }
+    }
+
+    typedef Filtration_radix_key<Filtration_value> Radix_key;
+    if (Radix_key::radix_sortable) {
+      std::vector<std::pair<typename Radix_key::type, Simplex_handle>> keys(filtration_vect_.size());
 #ifdef GUDHI_USE_TBB
-    tbb::parallel_sort(filtration_vect_.begin(), filtration_vect_.end(), is_before_in_filtration(this));
+      tbb::parallel_for(std::size_t(0), keys.size(), [&](std::size_t i) {
+        keys[i] = std::make_pair(Radix_key::key(filtration_vect_[i]->second.filtration()), filtration_vect_[i]);
+      });
+      stable_radix_sort(keys);
+      tbb::parallel_for(std::size_t(0), keys.size(), [&](std::size_t i) { filtration_vect_[i] = keys[i].second; });
 #else
-    std::stable_sort(filtration_vect_.begin(), filtration_vect_.end(), is_before_in_filtration(this));
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = std::make_pair(Radix_key::key(filtration_vect_[i]->second.filtration()), filtration_vect_[i]);
+      stable_radix_sort(keys);
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        filtration_vect_[i] = keys[i].second;
 #endif
+    } else {
+      std::vector<std::pair<Filtration_value, Simplex_handle>> keys(filtration_vect_.size());
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = std::make_pair(filtration_vect_[i]->second.filtration(), filtration_vect_[i]);
+      std::stable_sort(keys.begin(), keys.end(), [](const std::pair<Filtration_value, Simplex_handle>& a,
+                                                    const std::pair<Filtration_value, Simplex_handle>& b) {
+        return a.first < b.first;
+      });
+      for (std::size_t i = 0; i < keys.size(); ++i)
+        filtration_vect_[i] = keys[i].second;
+    }
   }
 
  private:
+  /** \brief Appends to boundary_cache_ the boundaries of the children of sh, whose own boundary must be cached.
+   *
+   * The boundary of the child \f$[\tau, v]\f$ of \f$\tau\f$ is \f$\tau\f$, followed by the children \f$[\phi, v]\f$
+   * of the faces \f$\phi\f$ of \f$\tau\f$ (or by the vertex \f$v\f$ if \f$\tau\f$ is a vertex), which is the
+   * order of the Boundary_simplex_iterator. As all the faces have the children of \f$\tau\f$ among their children,
+   * they are all found by one sweep of each sorted dictionary, instead of one search from the root per face.
+   */
+  void cache_boundaries_of_children(Simplex_handle sh) {
+    auto& children = sh->second.children()->members();
+    const std::size_t sh_boundary = sh->second.boundary_index();
+    std::size_t num_faces = 0;
+    while (boundary_cache_[sh_boundary + num_faces] != null_simplex()) ++num_faces;
+    // sh itself, one face per face of sh (or the vertex v for an edge), and the end marker
+    const std::size_t stride = (std::max)(num_faces, std::size_t(1)) + 2;
+    const std::size_t first = boundary_cache_.size();
+    boundary_cache_.resize(first + children.size() * stride, null_simplex());
+    std::size_t pos = first;
+    for (auto child = children.begin(); child != children.end(); ++child, pos += stride) {
+      child->second.assign_boundary_index(pos);
+      boundary_cache_[pos] = sh;
+    }
+    for (std::size_t f = 0; f < (std::max)(num_faces, std::size_t(1)); ++f) {
+      // The children of the empty face of a vertex are the vertices.
+      auto& face_children = (num_faces == 0) ? root_.members()
+                                             : boundary_cache_[sh_boundary + f]->second.children()->members();
+      auto face_child = face_children.begin();
+      pos = first + 1 + f;
+      for (auto child = children.begin(); child != children.end(); ++child, pos += stride) {
+        face_child = std::lower_bound(face_child, face_children.end(), child->first,
+                                      [](const Dit_value_t& node, Vertex_handle v) { return node.first < v; });
+        GUDHI_CHECK(face_child != face_children.end() && face_child->first == child->first,
+                    "the faces of a simplex must be in the complex");
+        boundary_cache_[pos] = face_child++;
+      }
+    }
+  }
+
+  /** \brief Invalidates the boundaries cached by initialize_filtration(), before a change of the tree structure. */
+  void clear_boundary_cache() {
+    if (cache_boundaries) boundary_cache_.clear();
+  }
+
   /** Recursive search of cofaces
    * This function uses DFS
    *\param vertices contains a list of vertices, which represent the vertices of the simplex not found yet.
@@ -1048,6 +1511,7 @@ class Simplex_tree {
   void insert_graph(const OneSkeletonGraph& skel_graph) {
     // the simplex tree must be empty
     assert(num_simplices() == 0);
+    clear_boundary_cache();
 
     if (boost::num_vertices(skel_graph) == 0) {
       return;
@@ -1087,7 +1551,7 @@ class Simplex_tree {
       if (v < u) std::swap(u, v);
       auto sh = find_vertex(u);
       if (!has_children(sh)) {
-        sh->second.assign_children(new Siblings(&root_, sh->first));
+        sh->second.assign_children(new_siblings(&root_, sh->first));
       }
 
       sh->second.children()->members().emplace(v,
@@ -1108,55 +1572,103 @@ class Simplex_tree {
    * 1 when calling the method. */
   void expansion(int max_dim) {
     if (max_dim <= 1) return;
+    clear_boundary_cache();
     dimension_ = max_dim;
+    // Scratch buffer for the intersections, owned by this call and reused by the whole recursion.
+    std::vector<std::pair<Vertex_handle, Node> > inter;
     for (Dictionary_it root_it = root_.members_.begin();
          root_it != root_.members_.end(); ++root_it) {
       if (has_children(root_it)) {
-        siblings_expansion(root_it->second.children(), max_dim - 1);
+        siblings_expansion(root_it->second.children(), max_dim - 1, dimension_, inter);
       }
     }
     dimension_ = max_dim - dimension_;
   }
 
+  /** \brief Parallel version of `expansion()`.
+   *
+   * The subtrees below the vertices are expanded concurrently, the biggest ones first, and the expansion of the
+   * children of a vertex is itself split across threads, so that a few high degree vertices do not serialize the
+   * computation. The resulting Simplex_tree is the same as the one computed by `expansion()`.
+   *
+   * Falls back on `expansion()` when GUDHI is not compiled with TBB.
+   *
+   * The Simplex_tree must contain no simplex of dimension bigger than
+   * 1 when calling the method. */
+  void parallel_expansion(int max_dim) {
+#ifdef GUDHI_USE_TBB
+    if (max_dim <= 1) return;
+    clear_boundary_cache();
+    std::vector<Siblings*> subtrees;
+    for (Dictionary_it root_it = root_.members_.begin(); root_it != root_.members_.end(); ++root_it) {
+      if (has_children(root_it)) subtrees.push_back(root_it->second.children());
+    }
+    // Highest degree vertices first, as their subtrees are the most expensive ones to build
+    std::stable_sort(subtrees.begin(), subtrees.end(), [](Siblings* sib1, Siblings* sib2) {
+      return sib1->members().size() > sib2->members().size();
+    });
+    // Each thread keeps track of the lowest remaining dimension reached, as siblings_expansion does with dimension_
+    tbb::combinable<int> lowest_k([max_dim]() { return max_dim; });
+    // One scratch buffer for the intersections per thread, owned by this call.
+    tbb::enumerable_thread_specific<std::vector<std::pair<Vertex_handle, Node> > > inter;
+    tbb::parallel_for(std::size_t(0), subtrees.size(), [&](std::size_t subtree_idx) {
+      Siblings* siblings = subtrees[subtree_idx];
+      // Equivalent to siblings_expansion(siblings, max_dim - 1, ...) where the loop on members is parallel.
+      // Each member only modifies its own subtree, and reads the (unmodified) vertex and edge levels.
+      tbb::parallel_for(std::size_t(0), siblings->members().size(), [&](std::size_t member_idx) {
+        int& thread_lowest_k = lowest_k.local();
+        if (thread_lowest_k > max_dim - 1) thread_lowest_k = max_dim - 1;
+        node_expansion(siblings, siblings->members().begin() + member_idx, max_dim - 1, thread_lowest_k, inter.local());
+      });
+    });
+    dimension_ = max_dim;
+    lowest_k.combine_each([this](int k) { dimension_ = (std::min)(dimension_, k); });
+    dimension_ = max_dim - dimension_;
+#else
+    expansion(max_dim);
+#endif  // GUDHI_USE_TBB
+  }
+
  private:
-  /** \brief Recursive expansion of the simplex tree.*/
+  /** \brief Recursive expansion of the simplex tree.
+   * lowest_k is updated with the lowest k reached by the recursion. */
   void siblings_expansion(Siblings * siblings,  // must contain elements
-                          int k) {
-    if (dimension_ > k) {
-      dimension_ = k;
+                          int k, int& lowest_k, std::vector<std::pair<Vertex_handle, Node> >& inter) {
+    if (lowest_k > k) {
+      lowest_k = k;
     }
     if (k == 0)
       return;
-    Dictionary_it next = siblings->members().begin();
-    ++next;
-
-#ifdef GUDHI_CAN_USE_CXX11_THREAD_LOCAL
-    thread_local
-#endif  // GUDHI_CAN_USE_CXX11_THREAD_LOCAL
-    std::vector<std::pair<Vertex_handle, Node> > inter;
     for (Dictionary_it s_h = siblings->members().begin();
-         s_h != siblings->members().end(); ++s_h, ++next) {
-      Simplex_handle root_sh = find_vertex(s_h->first);
-      if (has_children(root_sh)) {
-        intersection(
-                     inter,  // output intersection
-                     next,  // begin
-                     siblings->members().end(),  // end
-                     root_sh->second.children()->members().begin(),
-                     root_sh->second.children()->members().end(),
-                     s_h->second.filtration());
-        if (inter.size() != 0) {
-          Siblings * new_sib = new Siblings(siblings,  // oncles
-                                            s_h->first,  // parent
-                                            inter);  // boost::container::ordered_unique_range_t
-          inter.clear();
-          s_h->second.assign_children(new_sib);
-          siblings_expansion(new_sib, k - 1);
-        } else {
-          // ensure the children property
-          s_h->second.assign_children(siblings);
-          inter.clear();
-        }
+         s_h != siblings->members().end(); ++s_h) {
+      node_expansion(siblings, s_h, k, lowest_k, inter);
+    }
+  }
+
+  /** \brief Expansion of the subtree below s_h, element of siblings (with k > 0). Only modifies this subtree.
+   * inter is an empty scratch buffer, that is not shared with another thread. */
+  void node_expansion(Siblings * siblings, Dictionary_it s_h, int k, int& lowest_k,
+                      std::vector<std::pair<Vertex_handle, Node> >& inter) {
+    Simplex_handle root_sh = find_vertex(s_h->first);
+    if (has_children(root_sh)) {
+      intersection(
+                   inter,  // output intersection
+                   std::next(s_h),  // begin
+                   siblings->members().end(),  // end
+                   root_sh->second.children()->members().begin(),
+                   root_sh->second.children()->members().end(),
+                   s_h->second.filtration());
+      if (inter.size() != 0) {
+        Siblings * new_sib = new_siblings(siblings,  // oncles
+                                          s_h->first,  // parent
+                                          inter);  // boost::container::ordered_unique_range_t
+        inter.clear();
+        s_h->second.assign_children(new_sib);
+        siblings_expansion(new_sib, k - 1, lowest_k, inter);
+      } else {
+        // ensure the children property
+        s_h->second.assign_children(siblings);
+        inter.clear();
       }
     }
   }
@@ -1206,6 +1718,7 @@ class Simplex_tree {
    */
   template< typename Blocker >
   void expansion_with_blockers(int max_dim, Blocker block_simplex) {
+    clear_boundary_cache();
     // Loop must be from the end to the beginning, as higher dimension simplex are always on the left part of the tree
     for (auto& simplex : boost::adaptors::reverse(root_.members())) {
       if (has_children(&simplex)) {
@@ -1247,7 +1760,7 @@ class Simplex_tree {
       }
       if (intersection.size() != 0) {
         // Reverse the order to insert
-        Siblings * new_sib = new Siblings(siblings,  // oncles
+        Siblings * new_sib = new_siblings(siblings,  // oncles
                                           simplex->first,  // parent
                                           boost::adaptors::reverse(intersection));  // boost::container::ordered_unique_range_t
         std::vector<Vertex_handle> blocked_new_sib_vertex_list;
@@ -1264,7 +1777,7 @@ class Simplex_tree {
         }
         if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
           // Specific case where all have to be deleted
-          delete new_sib;
+          delete_siblings(new_sib);
           // ensure the children property
           simplex->second.assign_children(siblings);
         } else {
@@ -1379,6 +1892,7 @@ class Simplex_tree {
    * bound. If you care, you can call `dimension()` to recompute the exact dimension.
    */
   bool prune_above_filtration(Filtration_value filtration) {
+    clear_boundary_cache();
     return rec_prune_above_filtration(root(), filtration);
   }
 
@@ -1397,7 +1911,7 @@ class Simplex_tree {
     if (last == list.begin() && sib != root()) {
       // Removing the whole siblings, parent becomes a leaf.
       sib->oncles()->members()[sib->parent()].assign_children(sib->oncles());
-      delete sib;
+      delete_siblings(sib);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
       return true;
@@ -1455,6 +1969,7 @@ class Simplex_tree {
     // Guarantee the simplex has no children
     GUDHI_CHECK(!has_children(sh),
                 std::invalid_argument("Simplex_tree::remove_maximal_simplex - argument has children"));
+    clear_boundary_cache();
 
     // Simplex is a leaf, it means the child is the Siblings owning the leaf
     Siblings* child = sh->second.children();
@@ -1466,19 +1981,120 @@ class Simplex_tree {
     } else {
       // Sibling is emptied : must be deleted, and its parent must point on his own Sibling
       child->oncles()->members().at(child->parent()).assign_children(child->oncles());
-      delete child;
+      delete_siblings(child);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
     }
   }
 
+ public:
+  /** \brief Writes the complex on a stream, in a compact binary format that `deserialize()` reads back.
+   *
+   * The format starts with a versioned header, that records the byte order, the size of a vertex and the type of the
+   * filtration values. The simplices follow in the order of the tree, so that the reader neither sorts nor searches.
+   * The complex is written as the tree is traversed, through a buffer of bounded size.
+   *
+   * Only available if the filtration values are of an arithmetic type, or not stored.
+   *
+   * @param[in] os Output stream, that should be opened in binary mode.
+   * @exception std::runtime_error If the stream fails.
+   */
+  void serialize(std::ostream& os) {
+    Simplex_tree_binary_writer writer(os);
+    writer.write_header(Simplex_tree_binary_header::of<Simplex_tree>(dimension(), root_.members().size()));
+    rec_serialize(writer, &root_);
+    writer.flush();
+  }
+
+  /** \brief Reads a complex written by `serialize()` from a buffer, for instance a memory mapped file as in
+   * `Gudhi::read_simplex_tree_binary_file()`.
+   *
+   * @param[in] buffer Beginning of the binary representation of the complex.
+   * @param[in] size Size in bytes of the binary representation.
+   * @pre The Simplex_tree must be empty.
+   * @exception std::invalid_argument If the buffer is not a binary representation of a complex with the same types
+   * of vertices and filtration values, for instance if it is truncated. The Simplex_tree is then left empty.
+   */
+  void deserialize(const char* buffer, std::size_t size) {
+    GUDHI_CHECK(num_vertices() == 0, std::logic_error("Simplex_tree::deserialize - the Simplex_tree must be empty"));
+    Simplex_tree_binary_reader reader(buffer, size);
+    Simplex_tree_binary_header header = reader.read_header();
+    if (!header.is_compatible(Simplex_tree_binary_header::of<Simplex_tree>(-1, 0)))
+      throw std::invalid_argument("Simplex_tree::deserialize - different types of vertices or filtration values");
+    filtration_vect_.clear();
+    clear_boundary_cache();
+    try {
+      rec_deserialize(reader, &root_, header.num_vertices, header.dimension);
+      if (!reader.at_end())
+        throw std::invalid_argument("Simplex_tree::deserialize - unexpected data after the complex");
+    } catch (...) {
+      root_members_recursive_deletion();
+      dimension_ = -1;
+      throw;
+    }
+    dimension_ = header.dimension;
+    dimension_to_be_lowered_ = false;
+  }
+
+ private:
+  /* Number of children of a simplex in the binary format, as wide as a vertex. */
+  typedef typename std::make_unsigned<Vertex_handle>::type Serialized_children_count;
+
+  void rec_serialize(Simplex_tree_binary_writer& writer, Siblings* sib) {
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      writer.write(sh->first);
+      if (Options::store_filtration) writer.write(sh->second.filtration());
+      if (has_children(sh)) {
+        writer.write(static_cast<Serialized_children_count>(sh->second.children()->members().size()));
+        rec_serialize(writer, sh->second.children());
+      } else {
+        writer.write(Serialized_children_count(0));
+      }
+    }
+  }
+
+  /* Reads num_members simplices in sib and their subtrees, which are at most of dimension max_dim. The children are
+   * attached to their parent before they are read, so that the tree can always be deleted if the reading fails. */
+  void rec_deserialize(Simplex_tree_binary_reader& reader, Siblings* sib, std::uint64_t num_members, int max_dim) {
+    if (num_members == 0) return;
+    if (max_dim < 0) throw std::invalid_argument("Simplex_tree::deserialize - simplex above the dimension");
+    // Check the count against the size of the buffer before reserving, so that a corrupt count cannot allocate more
+    // than the buffer could describe.
+    const std::size_t member_bytes = sizeof(Vertex_handle) + (Options::store_filtration ? sizeof(Filtration_value) : 0)
+        + sizeof(Serialized_children_count);
+    if (num_members > reader.remaining() / member_bytes)
+      throw std::invalid_argument("Simplex_tree::deserialize - truncated buffer");
+    sib->members_.reserve(num_members);
+    for (std::uint64_t i = 0; i < num_members; ++i) {
+      Vertex_handle v = reader.template read<Vertex_handle>();
+      Filtration_value filtration = 0;
+      if (Options::store_filtration) filtration = reader.template read<Filtration_value>();
+      Serialized_children_count num_children = reader.template read<Serialized_children_count>();
+      // The vertices of the siblings are sorted, and larger than the vertex of their parent
+      if (v == null_vertex() || (!sib->members_.empty() && !((sib->members_.end() - 1)->first < v)) ||
+          (sib != &root_ && !(sib->parent() < v)))
+        throw std::invalid_argument("Simplex_tree::deserialize - invalid or unsorted vertices");
+      Simplex_handle sh = sib->members_.emplace_hint(sib->members_.end(), v, Node(sib, filtration));
+      if (num_children != 0) {
+        Siblings* children = new_siblings(sib, v);
+        sh->second.assign_children(children);
+        rec_deserialize(reader, children, num_children, max_dim - 1);
+      }
+    }
+  }
+
  private:
+  typedef typename Allocation_policy::Resource Allocation_resource;
+  /** \brief Memory resource of the Siblings and dictionaries. Declared first to be destroyed last.*/
+  Allocation_resource allocation_resource_;
   Vertex_handle null_vertex_;
   /** \brief Total number of simplices in the complex, without the empty simplex.*/
   /** \brief Set of simplex tree Nodes representing the vertices.*/
   Siblings root_;
   /** \brief Simplices ordered according to a filtration.*/
   std::vector<Simplex_handle> filtration_vect_;
+  /** \brief Boundaries of the simplices, each terminated by null_simplex(), when Options::cache_boundaries.*/
+  std::vector<Simplex_handle> boundary_cache_;
   /** \brief Upper bound on the dimension of the simplicial complex.*/
   int dimension_;
   bool dimension_to_be_lowered_ = false;
@@ -0,0 +1,233 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_SIMPLEX_TREE_ALLOCATION_H_
+#define SIMPLEX_TREE_SIMPLEX_TREE_ALLOCATION_H_
+
+#include <boost/container/flat_map.hpp>
+
+#include <algorithm>  // for std::max
+#include <atomic>
+#include <mutex>
+#include <memory>  // for std::unique_ptr
+#include <vector>
+#include <new>  // for std::bad_alloc
+#include <cstddef>  // for std::size_t, std::max_align_t
+#include <cstdlib>  // for std::malloc, std::free
+#include <functional>  // for std::less
+#include <utility>  // for std::forward, std::pair
+#include <type_traits>  // for std::true_type
+
+namespace Gudhi {
+
+/** \addtogroup simplex_tree
+ * @{ */
+
+/** \private
+ * \brief Thread safe monotonic memory arena.
+ *
+ * Memory is handed out from large blocks with a bump pointer and is only given back to the system when the arena is
+ * destroyed. The bump pointer is atomic, so that concurrent allocations (e.g. from
+ * `Simplex_tree::parallel_expansion()`) only lock when a new block is needed.
+ */
+class Simplex_tree_arena {
+ public:
+  explicit Simplex_tree_arena(std::size_t block_size = std::size_t(1) << 20)
+      : block_size_(block_size), current_(nullptr) { }
+
+  Simplex_tree_arena(const Simplex_tree_arena&) = delete;
+  Simplex_tree_arena& operator=(const Simplex_tree_arena&) = delete;
+
+  ~Simplex_tree_arena() {
+    for (Block* block : blocks_) std::free(block);
+  }
+
+  /** \brief Returns n bytes of memory, aligned as std::max_align_t. */
+  void* allocate(std::size_t n) {
+    n = (n + alignment - 1) / alignment * alignment;
+    while (true) {
+      Block* block = current_.load(std::memory_order_acquire);
+      if (block != nullptr) {
+        // The offset may overflow the block capacity, the block is then simply not used anymore.
+        std::size_t offset = block->used.fetch_add(n, std::memory_order_relaxed);
+        if (offset + n <= block->capacity) return block->data() + offset;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Another thread may have pushed a new block in the meantime
+      if (current_.load(std::memory_order_relaxed) == block) {
+        std::size_t capacity = (std::max)(block_size_, n);
+        void* memory = std::malloc(header_size + capacity);
+        if (memory == nullptr) throw std::bad_alloc();
+        Block* new_block = new(memory) Block(capacity);
+        blocks_.push_back(new_block);
+        reserved_bytes_ += capacity;
+        current_.store(new_block, std::memory_order_release);
+      }
+    }
+  }
+
+  /** \brief Returns the number of bytes reserved from the system. */
+  std::size_t reserved_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reserved_bytes_;
+  }
+
+ private:
+  static const std::size_t alignment = alignof(std::max_align_t);
+
+  struct Block {
+    explicit Block(std::size_t cap) : used(0), capacity(cap) { }
+    char* data() { return reinterpret_cast<char*>(this) + header_size; }
+    std::atomic<std::size_t> used;
+    std::size_t capacity;
+  };
+  static const std::size_t header_size = (sizeof(Block) + alignment - 1) / alignment * alignment;
+
+  std::size_t block_size_;
+  std::atomic<Block*> current_;
+  std::vector<Block*> blocks_;
+  std::size_t reserved_bytes_ = 0;
+  mutable std::mutex mutex_;
+};
+
+/** \private
+ * \brief Allocator on a `Simplex_tree_arena`. Deallocation is a no-op.
+ *
+ * A default constructed allocator (without arena) falls back on the global heap.
+ */
+template<class T>
+struct Simplex_tree_arena_allocator {
+  typedef T value_type;
+  // The allocator must follow the memory it was allocated from
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  template<class U> struct rebind {
+    typedef Simplex_tree_arena_allocator<U> other;
+  };
+
+  Simplex_tree_arena_allocator(Simplex_tree_arena* arena = nullptr) noexcept : arena_(arena) { }
+  template<class U>
+  Simplex_tree_arena_allocator(const Simplex_tree_arena_allocator<U>& other) noexcept : arena_(other.arena_) { }
+
+  T* allocate(std::size_t n) {
+    if (arena_ == nullptr) return static_cast<T*>(::operator new(n * sizeof(T)));
+    return static_cast<T*>(arena_->allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, std::size_t) noexcept {
+    if (arena_ == nullptr) ::operator delete(p);
+  }
+
+  Simplex_tree_arena* arena_;
+};
+
+template<class T, class U>
+bool operator==(const Simplex_tree_arena_allocator<T>& a1, const Simplex_tree_arena_allocator<U>& a2) {
+  return a1.arena_ == a2.arena_;
+}
+
+template<class T, class U>
+bool operator!=(const Simplex_tree_arena_allocator<T>& a1, const Simplex_tree_arena_allocator<U>& a2) {
+  return a1.arena_ != a2.arena_;
+}
+
+/** \brief Default allocation policy of `Simplex_tree`: every `Siblings` is allocated with `new`, and owns a
+ * `boost::container::flat_map` allocated on the heap. */
+struct Simplex_tree_default_allocation {
+  /* Type of dictionary Vertex_handle -> Node. */
+  template<class Vertex_handle, class Node>
+  using Dictionary = boost::container::flat_map<Vertex_handle, Node>;
+
+  /* Memory resource owned by the Simplex_tree. */
+  struct Resource {
+    /* Siblings have to be released one by one. */
+    static const bool releases_all_at_once = false;
+
+    template<class Dict>
+    typename Dict::allocator_type dictionary_allocator() const {
+      return typename Dict::allocator_type();
+    }
+
+    template<class Siblings, class...Args>
+    Siblings* new_siblings(Args&&...args) {
+      return new Siblings(std::forward<Args>(args)...);
+    }
+
+    template<class Siblings>
+    void delete_siblings(Siblings* sib) {
+      delete sib;
+    }
+  };
+};
+
+/** \brief Arena allocation policy of `Simplex_tree`.
+ *
+ * All the `Siblings` and their dictionaries are allocated contiguously, in creation order, in a monotonic arena
+ * owned by the `Simplex_tree`. This reduces the allocator overhead and the fragmentation, improves the cache
+ * behaviour of traversals that follow the construction order (like `Simplex_tree::expansion()`), and makes the
+ * destruction of the complex independent of its number of simplices.
+ *
+ * Memory is only given back when the complex is destroyed or assigned, so this policy is meant for complexes that
+ * are built once, e.g. by `Simplex_tree::insert_graph()` and `Simplex_tree::expansion()`, rather than for complexes
+ * that undergo many removals.
+ */
+struct Simplex_tree_arena_allocation {
+  template<class Vertex_handle, class Node>
+  using Dictionary = boost::container::flat_map<Vertex_handle, Node, std::less<Vertex_handle>,
+                                                Simplex_tree_arena_allocator<std::pair<Vertex_handle, Node>>>;
+
+  class Resource {
+   public:
+    /* The whole tree is released with the arena, no Siblings destructor needs to be called. */
+    static const bool releases_all_at_once = true;
+
+    Resource() : arena_(new Simplex_tree_arena()) { }
+
+    template<class Dict>
+    typename Dict::allocator_type dictionary_allocator() const {
+      return typename Dict::allocator_type(arena_.get());
+    }
+
+    template<class Siblings, class...Args>
+    Siblings* new_siblings(Args&&...args) {
+      return new(arena_->allocate(sizeof(Siblings))) Siblings(std::forward<Args>(args)...);
+    }
+
+    template<class Siblings>
+    void delete_siblings(Siblings* sib) {
+      sib->~Siblings();
+    }
+
+    /* Number of bytes reserved by the arena. */
+    std::size_t reserved_bytes() const {
+      return arena_->reserved_bytes();
+    }
+
+   private:
+    std::unique_ptr<Simplex_tree_arena> arena_;
+  };
+};
+
+/** \private Allocation policy of a SimplexTreeOptions: Options::Allocation_policy if it exists,
+ * Simplex_tree_default_allocation otherwise. */
+template<class Options, class = void>
+struct Simplex_tree_allocation_policy {
+  typedef Simplex_tree_default_allocation type;
+};
+
+template<class Options>
+struct Simplex_tree_allocation_policy<Options, typename std::conditional<true, void,
+                                                                         typename Options::Allocation_policy>::type> {
+  typedef typename Options::Allocation_policy type;
+};
+
+/** @} */  // end addtogroup simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SIMPLEX_TREE_ALLOCATION_H_
@@ -0,0 +1,133 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_SIMPLEX_TREE_FILTRATION_SORT_H_
+#define SIMPLEX_TREE_SIMPLEX_TREE_FILTRATION_SORT_H_
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint32_t, std::uint64_t
+#include <cstring>  // for std::memcpy
+#include <climits>  // for CHAR_BIT
+#include <algorithm>  // for std::min, std::fill
+#include <functional>  // for std::function
+#include <utility>  // for std::pair
+#include <type_traits>  // for std::is_floating_point, std::is_integral, std::make_unsigned, std::conditional
+
+namespace Gudhi {
+
+/** \addtogroup simplex_tree
+ * @{ */
+
+/** \private
+ * \brief Maps the filtration values to unsigned integers in the same order, so they can be radix sorted.
+ *
+ * `radix_sortable` is false when `Filtration_value` is neither a floating point type of 32 or 64 bits nor an
+ * integral type.
+ */
+template<typename Filtration_value, typename = void>
+struct Filtration_radix_key {
+  static const bool radix_sortable = false;
+  typedef std::uint64_t type;
+  static type key(Filtration_value) { return 0; }
+};
+
+template<typename Filtration_value>
+struct Filtration_radix_key<Filtration_value,
+                            typename std::enable_if<std::is_floating_point<Filtration_value>::value &&
+                                                    (sizeof(Filtration_value) == 4 ||
+                                                     sizeof(Filtration_value) == 8)>::type> {
+  static const bool radix_sortable = true;
+  typedef typename std::conditional<sizeof(Filtration_value) == 4, std::uint32_t, std::uint64_t>::type type;
+  static type key(Filtration_value f) {
+    // -0. and 0. compare equal, they must have the same key
+    if (f == 0) f = 0;
+    type bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    const type sign = type(1) << (sizeof(type) * CHAR_BIT - 1);
+    // Negative values are in reverse order of their bits
+    return (bits & sign) ? ~bits : (bits | sign);
+  }
+};
+
+template<typename Filtration_value>
+struct Filtration_radix_key<Filtration_value,
+                            typename std::enable_if<std::is_integral<Filtration_value>::value &&
+                                                    !std::is_same<Filtration_value, bool>::value>::type> {
+  static const bool radix_sortable = true;
+  typedef typename std::make_unsigned<Filtration_value>::type type;
+  static type key(Filtration_value f) {
+    const type sign = std::is_signed<Filtration_value>::value ? type(1) << (sizeof(type) * CHAR_BIT - 1) : 0;
+    return static_cast<type>(f) ^ sign;
+  }
+};
+
+/** \private
+ * \brief Stable sort of a vector of pairs by their first member, an unsigned integer, with a least significant digit
+ * radix sort.
+ *
+ * The vector is cut in chunks, that are counted and scattered in parallel when GUDHI is compiled with TBB. The passes
+ * on a digit that is the same for all the elements are skipped.
+ */
+template<typename Key, typename Value>
+void stable_radix_sort(std::vector<std::pair<Key, Value>>& elements) {
+  const int digit_bits = 8;
+  const std::size_t radix = std::size_t(1) << digit_bits;
+  const std::size_t n = elements.size();
+  // Large enough chunks that the counters of a chunk are small in comparison.
+  const std::size_t num_chunks = (std::min)(n / (64 * radix) + 1, std::size_t(256));
+  std::vector<std::pair<Key, Value>> buffer(n);
+  std::vector<std::size_t> counts(num_chunks * radix);
+  auto for_each_chunk = [&](std::function<void(std::size_t, std::size_t, std::size_t)> f) {
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_chunks, [&](std::size_t chunk) {
+      f(chunk, chunk * n / num_chunks, (chunk + 1) * n / num_chunks);
+    });
+#else
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+      f(chunk, chunk * n / num_chunks, (chunk + 1) * n / num_chunks);
+#endif
+  };
+
+  for (int shift = 0; shift < static_cast<int>(sizeof(Key) * CHAR_BIT); shift += digit_bits) {
+    std::fill(counts.begin(), counts.end(), 0);
+    for_each_chunk([&](std::size_t chunk, std::size_t first, std::size_t last) {
+      std::size_t* chunk_counts = &counts[chunk * radix];
+      for (std::size_t i = first; i < last; ++i)
+        ++chunk_counts[(elements[i].first >> shift) & (radix - 1)];
+    });
+    // Exclusive prefix sum, digit by digit and chunk by chunk within a digit, which makes the sort stable.
+    std::size_t sum = 0;
+    bool single_digit = false;
+    for (std::size_t digit = 0; digit < radix; ++digit) {
+      std::size_t digit_start = sum;
+      for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        std::size_t count = counts[chunk * radix + digit];
+        counts[chunk * radix + digit] = sum;
+        sum += count;
+      }
+      if (sum - digit_start == n) single_digit = true;
+    }
+    if (single_digit) continue;
+    for_each_chunk([&](std::size_t chunk, std::size_t first, std::size_t last) {
+      std::size_t* chunk_counts = &counts[chunk * radix];
+      for (std::size_t i = first; i < last; ++i)
+        buffer[chunk_counts[(elements[i].first >> shift) & (radix - 1)]++] = elements[i];
+    });
+    elements.swap(buffer);
+  }
+}
+
+/** @} */  // end addtogroup simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SIMPLEX_TREE_FILTRATION_SORT_H_
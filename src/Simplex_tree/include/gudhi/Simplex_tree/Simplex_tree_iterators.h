@@ -79,6 +79,9 @@ class Simplex_tree_simplex_vertex_iterator : public boost::iterator_facade<
 /* \brief Iterator over the simplices of the boundary of a
  *  simplex.
  *
+ * When the boundaries are cached by the SimplexTree, it only walks through the cache. Otherwise, each face is found
+ * by descending from the deepest common ancestor of the previous face.
+ *
  * Forward iterator, value_type is SimplexTree::Simplex_handle.*/
 template<class SimplexTree>
 class Simplex_tree_boundary_simplex_iterator : public boost::iterator_facade<
@@ -95,6 +98,7 @@ class Simplex_tree_boundary_simplex_iterator : public boost::iterator_facade<
         next_(st->null_vertex()),
         sib_(nullptr),
         sh_(st->null_simplex()),
+        cached_(nullptr),
         st_(st)  {
   }
 
@@ -104,7 +108,15 @@ class Simplex_tree_boundary_simplex_iterator : public boost::iterator_facade<
         next_(st->null_vertex()),
         sib_(nullptr),
         sh_(st->null_simplex()),
+        cached_(nullptr),
         st_(st) {
+    if (SimplexTree::cache_boundaries) {
+      cached_ = st->cached_boundary(sh);
+      if (cached_ != nullptr) {
+        sh_ = *cached_;
+        return;
+      }
+    }
     // Only check once at the beginning instead of for every increment, as this is expensive.
     if (SimplexTree::Options::contiguous_vertices)
       GUDHI_CHECK(st_->contiguous_vertices(), "The set of vertices is not { 0, ..., n } without holes");
@@ -133,6 +145,11 @@ class Simplex_tree_boundary_simplex_iterator : public boost::iterator_facade<
   }
 
   void increment() {
+    if (SimplexTree::cache_boundaries && cached_ != nullptr) {
+      // The cached boundary ends with null_simplex(), like the end() iterator.
+      sh_ = *++cached_;
+      return;
+    }
     if (sib_ == nullptr) {
       sh_ = st_->null_simplex();
       return;
@@ -179,6 +196,7 @@ class Simplex_tree_boundary_simplex_iterator : public boost::iterator_facade<
 #endif
   Siblings * sib_;  // where the next search will start from
   Simplex_handle sh_;  // current Simplex_handle in the boundary
+  Simplex_handle const* cached_;  // position of sh_ in the boundary cache, if any
   SimplexTree * st_;  // simplex containing the simplicial complex
 };
 /*---------------------------------------------------------------------------*/
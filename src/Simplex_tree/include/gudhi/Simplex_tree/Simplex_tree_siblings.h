@@ -56,7 +56,7 @@ class Simplex_tree_siblings {
   Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent)
       : oncles_(oncles),
         parent_(parent),
-        members_() {
+        members_(allocator_of(oncles)) {
   }
 
   /* \brief Constructor with initialized set of members.
@@ -67,7 +67,7 @@ class Simplex_tree_siblings {
       : oncles_(oncles),
         parent_(parent),
         members_(boost::container::ordered_unique_range, members.begin(),
-                 members.end()) {
+                 members.end(), typename Dictionary::key_compare(), allocator_of(oncles)) {
     for (auto& map_el : members_) {
       map_el.second.assign_children(this);
     }
@@ -110,6 +110,13 @@ class Simplex_tree_siblings {
     members_.erase(iterator);
   }
 
+  /* Dictionaries share the allocator of the root of the Simplex_tree. */
+  static typename Dictionary::allocator_type allocator_of(Simplex_tree_siblings * oncles) {
+    if (oncles == nullptr)
+      return typename Dictionary::allocator_type();
+    return oncles->members_.get_allocator();
+  }
+
   Simplex_tree_siblings * oncles_;
   Vertex_handle parent_;
   Dictionary members_;
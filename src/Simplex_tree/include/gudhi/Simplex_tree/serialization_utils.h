@@ -0,0 +1,187 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+#define SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+
+#include <ostream>
+#include <vector>
+#include <string>
+#include <stdexcept>  // for std::invalid_argument, std::runtime_error
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uint32_t, std::uint64_t, std::int32_t
+#include <cstring>  // for std::memcpy, std::memcmp
+#include <type_traits>  // for std::is_floating_point, std::is_integral, std::is_signed
+
+namespace Gudhi {
+
+/** \addtogroup simplex_tree
+ * @{ */
+
+/** \private
+ * \brief Header of the binary format of a `Simplex_tree`.
+ *
+ * The header is followed by the simplices in the order of a depth-first traversal of the tree: each record contains
+ * the vertex, the filtration value (only if the complex stores them) and the number of children of the simplex, this
+ * number with the width of a vertex, and the children follow their parent. The children of a simplex are sorted by
+ * vertex, so the tree is rebuilt by appending at the end of each dictionary, without any search.
+ *
+ * All the values are written in the byte order of the machine that writes them, which is checked by the reader.
+ */
+struct Simplex_tree_binary_header {
+  /* Kind of the filtration values. */
+  enum Filtration_kind : std::uint32_t { no_filtration = 0, signed_integer = 1, unsigned_integer = 2,
+                                         floating_point = 3 };
+
+  static const std::uint32_t current_version = 1;
+  static const std::uint32_t byte_order_mark = 0x01020304;
+  static const char* magic() { return "GUDHI_ST"; }
+  static const std::size_t magic_size = 8;
+
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint32_t vertex_bytes;
+  std::uint32_t filtration_kind;
+  std::uint32_t filtration_bytes;
+  std::int32_t dimension;
+  std::uint64_t num_vertices;
+
+  static const std::size_t size = magic_size + 6 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+  /* Describes a complex of SimplexTree type. */
+  template<class SimplexTree>
+  static Simplex_tree_binary_header of(int dimension, std::size_t num_vertices) {
+    typedef typename SimplexTree::Filtration_value Filtration_value;
+    static_assert(!SimplexTree::Options::store_filtration || std::is_arithmetic<Filtration_value>::value,
+                  "The binary format of a Simplex_tree only supports arithmetic filtration values");
+    Simplex_tree_binary_header header;
+    header.version = current_version;
+    header.byte_order = byte_order_mark;
+    header.vertex_bytes = sizeof(typename SimplexTree::Vertex_handle);
+    if (!SimplexTree::Options::store_filtration) {
+      header.filtration_kind = no_filtration;
+      header.filtration_bytes = 0;
+    } else {
+      header.filtration_kind = std::is_floating_point<Filtration_value>::value ? floating_point
+          : (std::is_signed<Filtration_value>::value ? signed_integer : unsigned_integer);
+      header.filtration_bytes = sizeof(Filtration_value);
+    }
+    header.dimension = dimension;
+    header.num_vertices = num_vertices;
+    return header;
+  }
+
+  /* Whether a complex with this header can be read in a complex of the same type as `other`. */
+  bool is_compatible(const Simplex_tree_binary_header& other) const {
+    return vertex_bytes == other.vertex_bytes && filtration_kind == other.filtration_kind &&
+        filtration_bytes == other.filtration_bytes;
+  }
+};
+
+/** \private
+ * \brief Buffered writer of raw values on a `std::ostream`.
+ *
+ * `flush()` must be called after the last value, it throws if the stream is in a failed state.
+ */
+class Simplex_tree_binary_writer {
+ public:
+  explicit Simplex_tree_binary_writer(std::ostream& os, std::size_t buffer_size = std::size_t(1) << 16)
+      : os_(os), buffer_(buffer_size), used_(0) { }
+
+  template<class T>
+  void write(const T& value) {
+    if (used_ + sizeof(T) > buffer_.size()) flush();
+    std::memcpy(buffer_.data() + used_, &value, sizeof(T));
+    used_ += sizeof(T);
+  }
+
+  void write_bytes(const char* bytes, std::size_t n) {
+    flush();
+    os_.write(bytes, n);
+  }
+
+  void write_header(const Simplex_tree_binary_header& header) {
+    write_bytes(Simplex_tree_binary_header::magic(), Simplex_tree_binary_header::magic_size);
+    write(header.version);
+    write(header.byte_order);
+    write(header.vertex_bytes);
+    write(header.filtration_kind);
+    write(header.filtration_bytes);
+    write(header.dimension);
+    write(header.num_vertices);
+  }
+
+  void flush() {
+    if (used_ != 0) os_.write(buffer_.data(), used_);
+    used_ = 0;
+    if (!os_) throw std::runtime_error("Simplex_tree::serialize - unable to write in the stream");
+  }
+
+ private:
+  std::ostream& os_;
+  std::vector<char> buffer_;
+  std::size_t used_;
+};
+
+/** \private
+ * \brief Reader of raw values from a memory buffer, e.g. a memory mapped file.
+ */
+class Simplex_tree_binary_reader {
+ public:
+  Simplex_tree_binary_reader(const char* buffer, std::size_t size) : ptr_(buffer), end_(buffer + size) { }
+
+  template<class T>
+  T read() {
+    if (static_cast<std::size_t>(end_ - ptr_) < sizeof(T))
+      throw std::invalid_argument("Simplex_tree::deserialize - truncated buffer");
+    T value;
+    std::memcpy(&value, ptr_, sizeof(T));
+    ptr_ += sizeof(T);
+    return value;
+  }
+
+  Simplex_tree_binary_header read_header() {
+    if (static_cast<std::size_t>(end_ - ptr_) < Simplex_tree_binary_header::size ||
+        std::memcmp(ptr_, Simplex_tree_binary_header::magic(), Simplex_tree_binary_header::magic_size) != 0)
+      throw std::invalid_argument("Simplex_tree::deserialize - not a binary Simplex_tree");
+    ptr_ += Simplex_tree_binary_header::magic_size;
+    Simplex_tree_binary_header header;
+    header.version = read<std::uint32_t>();
+    header.byte_order = read<std::uint32_t>();
+    if (header.byte_order != Simplex_tree_binary_header::byte_order_mark)
+      throw std::invalid_argument("Simplex_tree::deserialize - written with a different byte order");
+    if (header.version != Simplex_tree_binary_header::current_version)
+      throw std::invalid_argument("Simplex_tree::deserialize - unsupported version " +
+                                  std::to_string(header.version));
+    header.vertex_bytes = read<std::uint32_t>();
+    header.filtration_kind = read<std::uint32_t>();
+    header.filtration_bytes = read<std::uint32_t>();
+    header.dimension = read<std::int32_t>();
+    header.num_vertices = read<std::uint64_t>();
+    return header;
+  }
+
+  /* Whether the whole buffer has been read. */
+  bool at_end() const {
+    return ptr_ == end_;
+  }
+
+  /* Number of bytes left to read. */
+  std::size_t remaining() const {
+    return static_cast<std::size_t>(end_ - ptr_);
+  }
+
+ private:
+  const char* ptr_;
+  const char* end_;
+};
+
+/** @} */  // end addtogroup simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SERIALIZATION_UTILS_H_
@@ -0,0 +1,56 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_BINARY_FILE_H_
+#define SIMPLEX_TREE_BINARY_FILE_H_
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <fstream>
+#include <string>
+#include <stdexcept>  // for std::runtime_error
+
+namespace Gudhi {
+
+/** \addtogroup simplex_tree
+ * @{ */
+
+/** \brief Writes a `Simplex_tree` in a file, in the binary format of `Simplex_tree::serialize()`.
+ *
+ * @exception std::runtime_error If the file cannot be written.
+ */
+template<class SimplexTree>
+void write_simplex_tree_binary_file(const std::string& file_name, SimplexTree& st) {
+  std::ofstream os(file_name, std::ios::binary);
+  if (!os) throw std::runtime_error("Unable to open " + file_name);
+  st.serialize(os);
+}
+
+/** \brief Reads a `Simplex_tree` from a file written by `write_simplex_tree_binary_file()`.
+ *
+ * The file is mapped in memory and given to `Simplex_tree::deserialize()`, so it is read directly by the
+ * reconstruction of the tree, without intermediate copy.
+ *
+ * @pre The `Simplex_tree` must be empty.
+ * @exception std::invalid_argument If the file is not a binary representation of a complex of this type.
+ * @exception boost::interprocess::interprocess_exception If the file cannot be mapped.
+ */
+template<class SimplexTree>
+void read_simplex_tree_binary_file(const std::string& file_name, SimplexTree& st) {
+  boost::interprocess::file_mapping file(file_name.c_str(), boost::interprocess::read_only);
+  boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+  // The file is read once from the beginning to the end
+  region.advise(boost::interprocess::mapped_region::advice_sequential);
+  st.deserialize(static_cast<const char*>(region.get_address()), region.get_size());
+}
+
+/** @} */  // end addtogroup simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_BINARY_FILE_H_
@@ -0,0 +1,146 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdexcept>  // for std::invalid_argument
+#include <cstring>  // for std::memcpy
+#include <cstdint>  // for std::uint64_t
+#include <type_traits>  // for std::make_unsigned
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "simplex_tree_serialization"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+//  ^
+// /!\ Nothing else from Simplex_tree shall be included to test includes are well defined.
+#include "gudhi/Simplex_tree.h"
+#include "gudhi/Simplex_tree_binary_file.h"
+
+using namespace Gudhi;
+
+struct Simplex_tree_options_no_filtration : Simplex_tree_options_full_featured {
+  static const bool store_key = false;
+  static const bool store_filtration = false;
+  typedef short Vertex_handle;
+};
+
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  typedef Simplex_tree_arena_allocation Allocation_policy;
+};
+
+typedef boost::mpl::list<Simplex_tree<>,
+                         Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_no_filtration>,
+                         Simplex_tree<Simplex_tree_options_arena>
+                        > list_of_tested_variants;
+
+template<typename Stree_type>
+void fill_simplex_tree(Stree_type& st) {
+  const bool filtration = Stree_type::Options::store_filtration;
+  st.insert_simplex_and_subfaces({0, 1, 6, 7}, filtration ? 4.0 : 0.);
+  st.insert_simplex_and_subfaces({3, 4, 5}, filtration ? 3.0 : 0.);
+  st.insert_simplex_and_subfaces({3, 0}, filtration ? 2.0 : 0.);
+  st.insert_simplex_and_subfaces({2, 1, 0}, filtration ? 3.0 : 0.);
+  st.insert_simplex_and_subfaces({8}, filtration ? 1.5 : 0.);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(binary_serialization_round_trip, Stree_type, list_of_tested_variants) {
+  std::cout << "********************************************************************" << std::endl;
+  std::cout << "SIMPLEX TREE BINARY SERIALIZATION" << std::endl;
+
+  Stree_type st;
+  fill_simplex_tree(st);
+
+  std::ostringstream os(std::ios::binary);
+  st.serialize(os);
+  std::string buffer = os.str();
+  Stree_type read_st;
+  read_st.deserialize(buffer.data(), buffer.size());
+  std::cout << "The READ complex contains " << read_st.num_simplices() << " simplices - dimension = "
+            << read_st.dimension() << std::endl;
+  BOOST_CHECK(read_st.num_simplices() == st.num_simplices());
+  BOOST_CHECK(st == read_st);
+
+  // The filtration of the read complex can be used as usual
+  read_st.initialize_filtration();
+  BOOST_CHECK(read_st.filtration_simplex_range().size() == st.num_simplices());
+
+  // Through a memory mapped file
+  std::string binary_file("simplex_tree_for_serialization_unit_test.bin");
+  write_simplex_tree_binary_file(binary_file, st);
+  Stree_type mapped_st;
+  read_simplex_tree_binary_file(binary_file, mapped_st);
+  BOOST_CHECK(st == mapped_st);
+
+  // Empty complex
+  Stree_type empty_st;
+  std::ostringstream empty_os(std::ios::binary);
+  empty_st.serialize(empty_os);
+  std::string empty_buffer = empty_os.str();
+  Stree_type read_empty_st;
+  read_empty_st.deserialize(empty_buffer.data(), empty_buffer.size());
+  BOOST_CHECK(read_empty_st.num_simplices() == 0);
+  BOOST_CHECK(read_empty_st == empty_st);
+}
+
+BOOST_AUTO_TEST_CASE(binary_serialization_invalid_input) {
+  std::cout << "********************************************************************" << std::endl;
+  std::cout << "SIMPLEX TREE BINARY SERIALIZATION OF INVALID INPUT" << std::endl;
+
+  Simplex_tree<> st;
+  fill_simplex_tree(st);
+  std::ostringstream os(std::ios::binary);
+  st.serialize(os);
+  std::string buffer = os.str();
+
+  // Truncated buffer, the complex is left empty
+  Simplex_tree<> truncated_st;
+  BOOST_CHECK_THROW(truncated_st.deserialize(buffer.data(), buffer.size() - 1), std::invalid_argument);
+  BOOST_CHECK(truncated_st.num_simplices() == 0);
+
+  // Corrupt number of vertices, larger than what the buffer can hold
+  std::string corrupt_buffer = buffer;
+  const std::uint64_t huge_count = std::uint64_t(1) << 60;
+  std::memcpy(&corrupt_buffer[Gudhi::Simplex_tree_binary_header::size - sizeof(huge_count)], &huge_count,
+              sizeof(huge_count));
+  Simplex_tree<> corrupt_st;
+  BOOST_CHECK_THROW(corrupt_st.deserialize(corrupt_buffer.data(), corrupt_buffer.size()), std::invalid_argument);
+  BOOST_CHECK(corrupt_st.num_simplices() == 0);
+
+  // Child with a vertex that is not larger than the vertex of its parent: the edge {0, 1} written as {0, 0}
+  Simplex_tree<> edge_st;
+  edge_st.insert_simplex_and_subfaces({0, 1}, 1.);
+  std::ostringstream edge_os(std::ios::binary);
+  edge_st.serialize(edge_os);
+  std::string unsorted_buffer = edge_os.str();
+  typedef Simplex_tree<>::Vertex_handle Vertex_handle;
+  typedef Simplex_tree<>::Filtration_value Filtration_value;
+  // Header, then vertex 0 with its filtration value and number of children, then its child
+  const std::size_t child_offset = Gudhi::Simplex_tree_binary_header::size + sizeof(Vertex_handle) +
+                                   sizeof(Filtration_value) + sizeof(std::make_unsigned<Vertex_handle>::type);
+  Vertex_handle child;
+  std::memcpy(&child, &unsorted_buffer[child_offset], sizeof(child));
+  BOOST_CHECK(child == 1);
+  const Vertex_handle wrong_child = 0;
+  std::memcpy(&unsorted_buffer[child_offset], &wrong_child, sizeof(wrong_child));
+  Simplex_tree<> unsorted_st;
+  BOOST_CHECK_THROW(unsorted_st.deserialize(unsorted_buffer.data(), unsorted_buffer.size()), std::invalid_argument);
+  BOOST_CHECK(unsorted_st.num_simplices() == 0);
+
+  // Extra data
+  std::string longer_buffer = buffer + "x";
+  Simplex_tree<> longer_st;
+  BOOST_CHECK_THROW(longer_st.deserialize(longer_buffer.data(), longer_buffer.size()), std::invalid_argument);
+  BOOST_CHECK(longer_st.num_simplices() == 0);
+
+  // Not a binary Simplex_tree
+  std::string text("0 0\n1 0\n");
+  Simplex_tree<> text_st;
+  BOOST_CHECK_THROW(text_st.deserialize(text.data(), text.size()), std::invalid_argument);
+
+  // Other types of filtration values
+  Simplex_tree<Simplex_tree_options_fast_persistence> float_st;
+  BOOST_CHECK_THROW(float_st.deserialize(buffer.data(), buffer.size()), std::invalid_argument);
+  BOOST_CHECK(float_st.num_simplices() == 0);
+}
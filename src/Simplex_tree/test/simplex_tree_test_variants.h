@@ -0,0 +1,24 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_TEST_VARIANTS_H_
+#define SIMPLEX_TREE_TEST_VARIANTS_H_
+
+#include <boost/mpl/list.hpp>
+
+#include "gudhi/Simplex_tree.h"
+
+// Simplex_tree variants shared by the unit tests.
+
+struct Simplex_tree_options_arena : Gudhi::Simplex_tree_options_full_featured {
+  typedef Gudhi::Simplex_tree_arena_allocation Allocation_policy;
+};
+
+typedef boost::mpl::list<Gudhi::Simplex_tree<>, Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>,
+                         Gudhi::Simplex_tree<Simplex_tree_options_arena>> list_of_tested_variants;
+
+#endif  // SIMPLEX_TREE_TEST_VARIANTS_H_
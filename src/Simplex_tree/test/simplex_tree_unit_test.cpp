@@ -6,6 +6,7 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <functional> // greater
+#include <random>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -15,11 +16,10 @@
 //  ^
 // /!\ Nothing else from Simplex_tree shall be included to test includes are well defined.
 #include "gudhi/Simplex_tree.h"
+#include "simplex_tree_test_variants.h"
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
-
 
 template<class typeST>
 void test_empty_simplex_tree(typeST& tst) {
@@ -921,3 +921,313 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_insert_graph, Graph, list_of_graph_va
 
   BOOST_CHECK(st1 == st2);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_parallel_expansion, typeST, list_of_tested_variants) {
+  std::cout << "********************************************************************" << std::endl;
+  std::cout << "PARALLEL EXPANSION" << std::endl;
+  using Filtration_value = typename typeST::Filtration_value;
+
+  // Random graph with a few high degree vertices
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> filtration(0., 1.);
+  const int num_vertices = 120;
+  typeST st;
+  for (int u = 0; u < num_vertices; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = u + 1; v < num_vertices; ++v) {
+      double probability = (u < 4) ? 0.8 : 0.25;
+      if (filtration(gen) < probability)
+        st.insert_simplex({u, v}, static_cast<Filtration_value>(filtration(gen)));
+    }
+  }
+
+  for (int max_dim : {0, 1, 2, 3, 5, 50}) {
+    typeST st_seq(st);
+    typeST st_par(st);
+    st_seq.expansion(max_dim);
+    st_par.parallel_expansion(max_dim);
+    std::cout << "max_dim=" << max_dim << " - num_simplices=" << st_par.num_simplices() << " - dimension=" <<
+        st_par.dimension() << std::endl;
+    BOOST_CHECK(st_seq.num_simplices() == st_par.num_simplices());
+    BOOST_CHECK(st_seq.dimension() == st_par.dimension());
+    BOOST_CHECK(st_seq == st_par);
+  }
+
+  // Graph without edges
+  typeST st_seq;
+  typeST st_par;
+  for (int u = 0; u < 5; ++u) {
+    st_seq.insert_simplex({u}, 0.);
+    st_par.insert_simplex({u}, 0.);
+  }
+  st_seq.expansion(3);
+  st_par.parallel_expansion(3);
+  BOOST_CHECK(st_seq.dimension() == st_par.dimension());
+  BOOST_CHECK(st_seq == st_par);
+}
+
+struct Simplex_tree_options_integer_filtration : Simplex_tree_options_full_featured {
+  typedef int Filtration_value;
+};
+
+template<class typeST>
+void test_filtration_order(typeST& st) {
+  using Vertex_handle = typename typeST::Vertex_handle;
+  st.initialize_filtration();
+  BOOST_CHECK(st.filtration_simplex_range().size() == st.num_simplices());
+  bool first = true;
+  typename typeST::Filtration_value previous_filtration = 0;
+  std::vector<Vertex_handle> previous_vertices;
+  for (auto sh : st.filtration_simplex_range()) {
+    // Vertices in decreasing order, so that the reverse lexicographic order is the lexicographic order
+    std::vector<Vertex_handle> vertices(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    if (!first) {
+      BOOST_CHECK(previous_filtration <= st.filtration(sh));
+      if (previous_filtration == st.filtration(sh))
+        BOOST_CHECK(std::lexicographical_compare(previous_vertices.begin(), previous_vertices.end(),
+                                                 vertices.begin(), vertices.end()));
+    }
+    first = false;
+    previous_filtration = st.filtration(sh);
+    previous_vertices.swap(vertices);
+  }
+}
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>,
+                         Simplex_tree<Simplex_tree_options_integer_filtration>> list_of_filtration_variants;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_filtration_order, typeST, list_of_filtration_variants) {
+  std::cout << "********************************************************************" << std::endl;
+  std::cout << "FILTRATION ORDER" << std::endl;
+  using Filtration_value = typename typeST::Filtration_value;
+
+  // Few distinct filtration values, including negative ones and -0., so that there are many ties
+  std::mt19937 gen(4321);
+  std::uniform_int_distribution<int> vertex(0, 29);
+  std::uniform_int_distribution<int> filtration(-2, 2);
+  typeST st;
+  for (int v = 0; v < 30; ++v)
+    st.insert_simplex({v}, static_cast<Filtration_value>(-3.));
+  for (int i = 0; i < 200; ++i) {
+    std::vector<int> simplex = {vertex(gen), vertex(gen), vertex(gen), vertex(gen)};
+    std::sort(simplex.begin(), simplex.end());
+    simplex.erase(std::unique(simplex.begin(), simplex.end()), simplex.end());
+    int f = filtration(gen);
+    st.insert_simplex_and_subfaces(simplex, (f == 0) ? static_cast<Filtration_value>(-0.)
+                                                     : static_cast<Filtration_value>(f));
+  }
+  st.make_filtration_non_decreasing();
+  test_filtration_order(st);
+
+  // Same complex on non-contiguous vertices
+  if (!typeST::Options::contiguous_vertices) {
+    typeST st_shifted;
+    for (auto sh : st.complex_simplex_range()) {
+      std::vector<int> simplex;
+      for (auto v : st.simplex_vertex_range(sh))
+        simplex.push_back(3 * v + 1000);
+      st_shifted.insert_simplex(simplex, st.filtration(sh));
+    }
+    test_filtration_order(st_shifted);
+  }
+
+  typeST st_empty;
+  test_filtration_order(st_empty);
+}
+
+struct Simplex_tree_options_cached_boundaries : Simplex_tree_options_full_featured {
+  static const bool cache_boundaries = true;
+};
+
+struct Simplex_tree_options_fast_cached_boundaries : Simplex_tree_options_fast_persistence {
+  static const bool cache_boundaries = true;
+};
+
+template<class typeST>
+std::vector<std::vector<typename typeST::Vertex_handle>> boundary_vertices(typeST& st,
+                                                                          typename typeST::Simplex_handle sh) {
+  std::vector<std::vector<typename typeST::Vertex_handle>> boundary;
+  for (auto b_sh : st.boundary_simplex_range(sh))
+    boundary.emplace_back(st.simplex_vertex_range(b_sh).begin(), st.simplex_vertex_range(b_sh).end());
+  return boundary;
+}
+
+// Compares the boundaries in st with the ones computed by a tree that does not cache them
+template<class typeST>
+void test_cached_boundaries(typeST& st) {
+  Simplex_tree<> st_ref;
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<int> simplex(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    st_ref.insert_simplex(simplex, st.filtration(sh));
+  }
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<int> simplex(st.simplex_vertex_range(sh).begin(), st.simplex_vertex_range(sh).end());
+    auto boundary = boundary_vertices(st, sh);
+    auto boundary_ref = boundary_vertices(st_ref, st_ref.find(simplex));
+    BOOST_CHECK(boundary.size() == boundary_ref.size());
+    BOOST_CHECK(std::equal(boundary.begin(), boundary.end(), boundary_ref.begin()));
+  }
+}
+
+typedef boost::mpl::list<Simplex_tree<Simplex_tree_options_cached_boundaries>,
+                         Simplex_tree<Simplex_tree_options_fast_cached_boundaries>> list_of_cached_boundary_variants;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_cached_boundaries, typeST, list_of_cached_boundary_variants) {
+  std::cout << "********************************************************************" << std::endl;
+  std::cout << "CACHED BOUNDARIES" << std::endl;
+  BOOST_CHECK(typeST::cache_boundaries);
+  BOOST_CHECK(!Simplex_tree<>::cache_boundaries);
+
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<int> vertex(0, 19);
+  typeST st;
+  for (int v = 0; v < 20; ++v)
+    st.insert_simplex({v}, 0.);
+  for (int i = 0; i < 100; ++i) {
+    std::vector<int> simplex = {vertex(gen), vertex(gen), vertex(gen), vertex(gen), vertex(gen)};
+    std::sort(simplex.begin(), simplex.end());
+    simplex.erase(std::unique(simplex.begin(), simplex.end()), simplex.end());
+    st.insert_simplex_and_subfaces(simplex, static_cast<typename typeST::Filtration_value>(i));
+  }
+  // Without the cache
+  test_cached_boundaries(st);
+  st.initialize_filtration();
+  test_cached_boundaries(st);
+  for (auto sh : st.filtration_simplex_range()) {
+    int num_faces = 0;
+    for (auto b_sh : st.boundary_simplex_range(sh)) {
+      BOOST_CHECK(st.filtration(b_sh) <= st.filtration(sh));
+      ++num_faces;
+    }
+    BOOST_CHECK(num_faces == (st.dimension(sh) == 0 ? 0 : st.dimension(sh) + 1));
+  }
+
+  // The moved complex keeps its cache, the copy computes the boundaries again
+  typeST st_moved(std::move(st));
+  test_cached_boundaries(st_moved);
+  typeST st_copy(st_moved);
+  test_cached_boundaries(st_copy);
+
+  // Modifications invalidate the cache
+  st_moved.insert_simplex_and_subfaces({0, 1, 2, 3, 4, 5}, 200.);
+  test_cached_boundaries(st_moved);
+  st_moved.initialize_filtration();
+  test_cached_boundaries(st_moved);
+  st_moved.prune_above_filtration(50.);
+  test_cached_boundaries(st_moved);
+  st_moved.initialize_filtration();
+  test_cached_boundaries(st_moved);
+}
+
+// Checks that st and st_ref contain the same simplices, and that the structure of st can be traversed upwards
+template<class typeST>
+void test_same_complex(typeST& st, typeST& st_ref) {
+  BOOST_CHECK(st == st_ref);
+  BOOST_CHECK(st.num_simplices() == st_ref.num_simplices());
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<typename typeST::Vertex_handle> simplex(st.simplex_vertex_range(sh).begin(),
+                                                        st.simplex_vertex_range(sh).end());
+    BOOST_CHECK(st.find(simplex) == sh);
+    auto sh_ref = st_ref.find(simplex);
+    BOOST_CHECK(sh_ref != st_ref.null_simplex() && st.filtration(sh) == st_ref.filtration(sh_ref));
+    int num_faces = 0;
+    for (auto b_sh : st.boundary_simplex_range(sh)) {
+      BOOST_CHECK(st.dimension(b_sh) == st.dimension(sh) - 1);
+      ++num_faces;
+    }
+    BOOST_CHECK(num_faces == (st.dimension(sh) == 0 ? 0 : st.dimension(sh) + 1));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_bulk_insertion, typeST, list_of_tested_variants) {
+  std::cout << "********************************************************************" << std::endl;
+  std::cout << "BULK INSERTION" << std::endl;
+  using Vertex_handle = typename typeST::Vertex_handle;
+  using Filtration_value = typename typeST::Filtration_value;
+  using Simplex_and_filtration = std::pair<std::vector<Vertex_handle>, Filtration_value>;
+
+  std::mt19937 gen(2345);
+  std::uniform_int_distribution<int> vertex(0, 24);
+  std::vector<Simplex_and_filtration> generators;
+  typeST st_ref;
+  for (int v = 0; v < 25; ++v) {
+    generators.push_back({{v}, static_cast<Filtration_value>(50.)});
+    st_ref.insert_simplex_and_subfaces({v}, static_cast<Filtration_value>(50.));
+  }
+  for (int i = 0; i < 60; ++i) {
+    std::vector<Vertex_handle> simplex = {vertex(gen), vertex(gen), vertex(gen), vertex(gen), vertex(gen)};
+    std::sort(simplex.begin(), simplex.end());
+    simplex.erase(std::unique(simplex.begin(), simplex.end()), simplex.end());
+    // Any order of the vertices
+    std::shuffle(simplex.begin(), simplex.end(), gen);
+    Filtration_value filtration = static_cast<Filtration_value>(i % 7);
+    st_ref.insert_simplex_and_subfaces(simplex, filtration);
+    generators.push_back({simplex, filtration});
+  }
+
+  // From the generators, in any order
+  typeST st_maximal;
+  st_maximal.insert_maximal_simplices(generators);
+  test_same_complex(st_maximal, st_ref);
+
+  // Vertices that are too sparse to be renumbered by an offset
+  if (!typeST::Options::contiguous_vertices) {
+    std::vector<Simplex_and_filtration> sparse_generators(generators);
+    typeST st_sparse_ref;
+    for (auto& generator : sparse_generators) {
+      for (auto& v : generator.first) v = 100000 * v - 1000000;
+      st_sparse_ref.insert_simplex_and_subfaces(generator.first, generator.second);
+    }
+    typeST st_sparse;
+    st_sparse.insert_maximal_simplices(sparse_generators);
+    test_same_complex(st_sparse, st_sparse_ref);
+  }
+
+  // From all the simplices, in lexicographic order
+  std::vector<Simplex_and_filtration> simplices;
+  for (auto sh : st_ref.complex_simplex_range()) {
+    std::vector<Vertex_handle> simplex(st_ref.simplex_vertex_range(sh).begin(), st_ref.simplex_vertex_range(sh).end());
+    std::reverse(simplex.begin(), simplex.end());
+    simplices.push_back({simplex, st_ref.filtration(sh)});
+  }
+  std::sort(simplices.begin(), simplices.end());
+  typeST st_sorted;
+  st_sorted.insert_sorted_simplices(simplices);
+  test_same_complex(st_sorted, st_ref);
+  st_sorted.initialize_filtration();
+  BOOST_CHECK(st_sorted.filtration_simplex_range().size() == st_ref.num_simplices());
+
+  typeST st_empty;
+  st_empty.insert_sorted_simplices(std::vector<Simplex_and_filtration>());
+  BOOST_CHECK(st_empty.num_simplices() == 0);
+  BOOST_CHECK(st_empty.dimension() == -1);
+  st_empty.insert_maximal_simplices(std::vector<Simplex_and_filtration>());
+  BOOST_CHECK(st_empty.num_simplices() == 0);
+
+  // Unsorted simplices, and missing faces. The complex is left empty.
+  std::vector<Simplex_and_filtration> unsorted(simplices);
+  std::swap(unsorted[5], unsorted[unsorted.size() - 5]);
+  typeST st_unsorted;
+  BOOST_CHECK_THROW(st_unsorted.insert_sorted_simplices(unsorted), std::invalid_argument);
+  BOOST_CHECK(st_unsorted.num_simplices() == 0);
+  std::vector<Simplex_and_filtration> missing_face(simplices);
+  for (auto it = missing_face.begin(); it != missing_face.end(); ++it) {
+    if (it->first.size() == 2) {
+      missing_face.erase(it);
+      break;
+    }
+  }
+  typeST st_missing_face;
+  BOOST_CHECK_THROW(st_missing_face.insert_sorted_simplices(missing_face), std::invalid_argument);
+  BOOST_CHECK(st_missing_face.num_simplices() == 0);
+  // Vertices of a simplex that are not in increasing order
+  for (std::vector<Simplex_and_filtration> unsorted_vertices : {
+           std::vector<Simplex_and_filtration>{{{0}, 0.}, {{0, 0}, 0.}},
+           std::vector<Simplex_and_filtration>{{{0}, 0.}, {{1}, 0.}, {{1, 0}, 0.}},
+           std::vector<Simplex_and_filtration>{{{0}, 0.}, {{0, 2}, 0.}, {{0, 2, 1}, 0.}, {{1}, 0.}, {{2}, 0.}}}) {
+    typeST st_unsorted_vertices;
+    BOOST_CHECK_THROW(st_unsorted_vertices.insert_sorted_simplices(unsorted_vertices), std::invalid_argument);
+    BOOST_CHECK(st_unsorted_vertices.num_simplices() == 0);
+  }
+}
@@ -3,4 +3,5 @@
 
 include_directories ( ${TBB_INCLUDE_DIRS} )
 link_directories( ${TBB_LIBRARY_DIRS} )
-add_definitions( -DNOMINMAX -DGUDHI_USE_TBB )
+# CGAL_LINKED_WITH_TBB enables the concurrent CGAL triangulations, as CGAL UseTBB does
+add_definitions( -DNOMINMAX -DCGAL_LINKED_WITH_TBB -DGUDHI_USE_TBB )